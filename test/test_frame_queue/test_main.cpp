@@ -0,0 +1,98 @@
+/*
+ * Host test of FrameQueue (render -> output handoff of the render task pipeline)
+ * Producer and consumer run in their own std::thread like render and output task on ESP32.
+ * Checks that every frame arrives complete and in order, and reports time spent per stage.
+ *
+ * Build & run: g++ -std=c++11 -O2 -pthread -I wled00 test/test_frame_queue/test_main.cpp -o fq_test && ./fq_test
+ */
+
+#include <stdio.h>
+#include <thread>
+#include <chrono>
+#include "frame_queue.h"
+
+#define TEST_LEN     1024   // pixels per frame
+#define TEST_FRAMES  20000
+
+typedef std::chrono::steady_clock test_clock;
+
+static int failures = 0;
+#define CHECK(c) do { if (!(c)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #c); failures++; } } while (0)
+
+static unsigned long nsSince(test_clock::time_point t) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(test_clock::now() - t).count();
+}
+
+// single thread: full/empty detection and slot order
+static void testBasics() {
+  FrameQueue q;
+  CHECK(!q.begin(0));
+  CHECK(!q.begin(16, 1));
+  CHECK(q.begin(16, 3));
+  CHECK(q.capacity() == 2 && q.size() == 0 && q.peek() == nullptr);
+  uint32_t *a = q.acquire(); CHECK(a); a[0] = 1; q.commit();
+  uint32_t *b = q.acquire(); CHECK(b && b != a); b[0] = 2; q.commit();
+  CHECK(q.acquire() == nullptr); // full, one slot kept free
+  CHECK(q.size() == 2);
+  CHECK(q.peek() && q.peek()[0] == 1); q.release();
+  CHECK(q.peek() && q.peek()[0] == 2); q.release();
+  CHECK(q.peek() == nullptr && q.size() == 0);
+  for (int i = 0; i < 10; i++) { // wrap around
+    uint32_t *f = q.acquire(); CHECK(f); f[0] = i; q.commit();
+    CHECK(q.peek() && q.peek()[0] == (uint32_t)i); q.release();
+  }
+  q.end();
+  CHECK(!q.isActive() && q.acquire() == nullptr && q.peek() == nullptr);
+}
+
+// producer (render) and consumer (output) threads
+static void testThreads(uint8_t slots) {
+  FrameQueue q;
+  CHECK(q.begin(TEST_LEN, slots));
+  unsigned long renderNs = 0, outputNs = 0, producerWaits = 0, consumerWaits = 0;
+  bool torn = false, order = true;
+
+  std::thread producer([&]() {
+    for (uint32_t n = 1; n <= TEST_FRAMES; n++) {
+      uint32_t *f;
+      while (!(f = q.acquire())) { producerWaits++; std::this_thread::yield(); } // output busy
+      auto t = test_clock::now();
+      for (size_t i = 0; i < TEST_LEN; i++) f[i] = n; // "render"
+      renderNs += nsSince(t);
+      q.commit();
+    }
+  });
+  std::thread consumer([&]() {
+    uint32_t last = 0;
+    while (last < TEST_FRAMES) {
+      const uint32_t *f;
+      while (!(f = q.peek())) { consumerWaits++; std::this_thread::yield(); }
+      auto t = test_clock::now();
+      uint32_t n = f[0];
+      for (size_t i = 1; i < TEST_LEN; i++) if (f[i] != n) torn = true; // "send"
+      if (n != last + 1) order = false;
+      last = n;
+      outputNs += nsSince(t);
+      q.release();
+    }
+  });
+  auto t = test_clock::now();
+  producer.join();
+  consumer.join();
+  unsigned long totalUs = nsSince(t) / 1000;
+
+  CHECK(!torn);
+  CHECK(order);
+  CHECK(q.size() == 0);
+  printf("slots %u: %u frames in %lu us, render %.2f us/frame, output %.2f us/frame, waits render %lu output %lu\n",
+    slots, TEST_FRAMES, totalUs, renderNs/1000.0/TEST_FRAMES, outputNs/1000.0/TEST_FRAMES, producerWaits, consumerWaits);
+}
+
+int main() {
+  testBasics();
+  testThreads(2);
+  testThreads(3);
+  testThreads(4);
+  printf(failures ? "FAILED (%d)\n" : "OK\n", failures);
+  return failures ? 1 : 0;
+}
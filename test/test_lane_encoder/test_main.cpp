@@ -0,0 +1,99 @@
+/*
+ * Host test of LaneEncoder (bit transposing encoder of the parallel WS2812 bus)
+ * Compares encode() with a bit by bit reference for all lane counts, brightness and word order,
+ * and reports encoding time per frame.
+ *
+ * Build & run: g++ -std=c++11 -O2 -I wled00 test/test_lane_encoder/test_main.cpp -o le_test && ./le_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <chrono>
+#include "lane_encoder.h"
+
+#define BENCH_LANES  8
+#define BENCH_LEN    256    // pixels per lane
+#define BENCH_FRAMES 500
+
+typedef std::chrono::steady_clock test_clock;
+
+static int failures = 0;
+#define CHECK(c) do { if (!(c)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #c); failures++; } } while (0)
+
+// one slot word at a time, straight from the description in lane_encoder.h
+static void encodeReference(uint16_t *out, const uint8_t *data, uint8_t lanes, uint16_t lenPerLane, uint8_t channels, uint8_t bri, bool swapPairs) {
+  const size_t stride = (size_t)lenPerLane * channels;
+  size_t k = 0;
+  for (size_t i = 0; i < stride; i++) {
+    for (int bit = 7; bit >= 0; bit--) {
+      uint16_t w = 0;
+      for (unsigned l = 0; l < lanes; l++) {
+        uint8_t v = data[l*stride + i];
+        if (bri != 255) v = (v * (bri + 1)) >> 8;
+        if (v & (1 << bit)) w |= 1 << l;
+      }
+      uint16_t slot[3] = {(uint16_t)((1UL << lanes) - 1), w, 0};
+      for (int s = 0; s < 3; s++, k++) out[swapPairs ? k ^ 1 : k] = slot[s];
+    }
+  }
+}
+
+static void testTranspose() {
+  for (int n = 0; n < 1000; n++) {
+    uint8_t in[8], out[8];
+    for (int l = 0; l < 8; l++) in[l] = rand();
+    LaneEncoder::transpose8(in, out);
+    for (int b = 0; b < 8; b++) for (int l = 0; l < 8; l++)
+      CHECK(((out[b] >> l) & 1) == ((in[l] >> (7-b)) & 1));
+  }
+}
+
+static void testEncode() {
+  const uint8_t bris[] = {255, 128, 1, 0};
+  for (uint8_t lanes = 1; lanes <= LANE_MAX_LANES; lanes++) {
+    for (uint16_t len = 1; len <= 5; len += 2) {
+      std::vector<uint8_t> data((size_t)lanes * len * 3);
+      for (auto &b : data) b = rand();
+      size_t words = LaneEncoder::frameWords(len, 3);
+      std::vector<uint16_t> got(words), want(words);
+      for (uint8_t bri : bris) for (int swap = 0; swap < 2; swap++) {
+        memset(got.data(), 0xA5, words*2);
+        LaneEncoder::encode(got.data(), data.data(), lanes, len, 3, bri, swap);
+        encodeReference(want.data(), data.data(), lanes, len, 3, bri, swap);
+        if (memcmp(got.data(), want.data(), words*2)) {
+          printf("FAIL lanes %u len %u bri %u swap %d\n", lanes, len, bri, swap);
+          failures++;
+        }
+      }
+    }
+  }
+}
+
+static void bench() {
+  std::vector<uint8_t>  data(BENCH_LANES * BENCH_LEN * 3);
+  std::vector<uint16_t> out(LaneEncoder::frameWords(BENCH_LEN, 3));
+  for (auto &b : data) b = rand();
+  const unsigned mode[][2] = {{255,0},{128,1}};
+  for (auto &m : mode) {
+    unsigned sum = 0;
+    test_clock::time_point t = test_clock::now();
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+      LaneEncoder::encode(out.data(), data.data(), BENCH_LANES, BENCH_LEN, 3, m[0], m[1]);
+      sum += out[f % out.size()];
+    }
+    double us = std::chrono::duration_cast<std::chrono::nanoseconds>(test_clock::now() - t).count() / 1000.0 / BENCH_FRAMES;
+    printf("encode %u lanes x %u px, bri %u swap %u: %.1f us/frame, %.1f ns/px (%u)\n",
+           BENCH_LANES, BENCH_LEN, m[0], m[1], us, us * 1000.0 / (BENCH_LANES * BENCH_LEN), sum & 1);
+  }
+}
+
+int main() {
+  srand(1);
+  testTranspose();
+  testEncode();
+  bench();
+  printf(failures ? "%d failures\n" : "all tests passed\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,189 @@
+/*
+ * Host test of the Adalight/TPM2 serial handler (wled_serial.cpp)
+ * Streams of Adalight and TPM2 frames (as sent by Prismatik, Hyperion or Jinx) are fed through a stub Serial
+ * in chunks like UART reads between loop() calls. Checks that every frame arrives complete and
+ * unchanged, and reports the throughput of handleSerial() in bytes/s.
+ * WLED_H is defined so that wled_serial.cpp uses the stubs below instead of wled.h.
+ *
+ * Build & run: g++ -std=c++11 -O2 test/test_serial_ingest/test_main.cpp -o serial_test && ./serial_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <chrono>
+
+#define WLED_H
+#define WLED_ENABLE_ADALIGHT
+#define VERSION 2405180
+
+typedef uint8_t byte;
+#define F(s)          s
+#define PSTR(s)       s
+#define sprintf_P     sprintf
+#define MIN(a,b)      ((a)<(b)?(a):(b))
+#define highByte(w)   ((uint8_t)((w) >> 8))
+#define lowByte(w)    ((uint8_t)((w) & 0xFF))
+#define R(c)          ((uint8_t)((c) >> 16))
+#define G(c)          ((uint8_t)((c) >> 8))
+#define B(c)          ((uint8_t)(c))
+#define W(c)          ((uint8_t)((c) >> 24))
+static inline uint8_t qadd8(uint8_t a, uint8_t b) { unsigned s = a + b; return s > 255 ? 255 : s; }
+static inline void yield() {}
+
+// receive side of a UART: bytes become available in chunks, transmitted bytes are counted
+struct StubSerial {
+  const uint8_t *rx = nullptr;
+  size_t rxLen = 0, rxPos = 0, rxAvail = 0;   // rxAvail: end of bytes "received" so far
+  size_t txBytes = 0;
+  explicit operator bool() const { return true; }
+  int    available() { return rxAvail - rxPos; }
+  int    peek()      { return rxPos < rxAvail ? rx[rxPos] : -1; }
+  int    read()      { return rxPos < rxAvail ? rx[rxPos++] : -1; }
+  size_t readBytes(uint8_t *buf, size_t len) {
+    len = MIN(len, rxAvail - rxPos);
+    memcpy(buf, rx + rxPos, len);
+    rxPos += len;
+    return len;
+  }
+  size_t write(uint8_t)                  { txBytes++; return 1; }
+  size_t write(const uint8_t*, size_t n) { txBytes += n; return n; }
+  template <typename T> void print(T)    {}
+  template <typename T> void println(T)  {}
+  void println() {}
+  void flush() {}
+  void begin(unsigned long) {}
+  void setTimeout(unsigned long) {}
+} Serial;
+
+enum class PinOwner : uint8_t { None = 0, DebugOut = 0x89 };
+struct {
+  bool     isPinAllocated(int8_t) { return false; }
+  PinOwner getPinOwner(int8_t)    { return PinOwner::None; }
+} pinManager;
+static const int8_t hardwareRX = 3, hardwareTX = 1;
+
+// pixels written by the handler, a frame is complete when show() is called
+#define TEST_MAX_PIXELS 2048
+static uint8_t  pixelData[TEST_MAX_PIXELS*3];
+static uint16_t pixelsSet = 0;
+static std::vector<std::vector<uint8_t>> shownFrames;
+struct {
+  uint16_t getLengthTotal()        { return TEST_MAX_PIXELS; }
+  uint32_t getPixelColor(uint16_t) { return 0; }
+  uint32_t getLastShow()           { return 0; }
+  void show() { shownFrames.emplace_back(pixelData, pixelData + pixelsSet*3); pixelsSet = 0; }
+} strip;
+
+#define REALTIME_MODE_ADALIGHT 5
+static uint8_t  realtimeOverride  = 0;
+static uint32_t realtimeTimeoutMs = 2500;
+static void realtimeLock(uint32_t, byte) {}
+static void setRealtimePixels(uint16_t i, const byte *rgb, uint16_t count) {
+  if (i + count > TEST_MAX_PIXELS) count = TEST_MAX_PIXELS - i;
+  memcpy(pixelData + i*3, rgb, count*3);
+  if (i + count > pixelsSet) pixelsSet = i + count;
+}
+static void handleImprovPacket() {}
+
+// JSON API over serial is not exercised (buffer lock is never granted)
+struct JsonObject {};
+struct DeserializationError { explicit operator bool() const { return true; } };
+struct {
+  void clear() {}
+  template <typename T> T as() { return T(); }
+  JsonObject createNestedObject(const char*) { return JsonObject(); }
+} doc;
+template <typename D, typename S> DeserializationError deserializeJson(D&, S&) { return DeserializationError(); }
+template <typename D, typename S> void serializeJson(D&, S&) {}
+static bool requestJSONBufferLock(uint8_t) { return false; }
+static void releaseJSONBufferLock() {}
+static bool deserializeState(JsonObject) { return false; }
+static void serializeState(JsonObject) {}
+static void serializeInfo(JsonObject) {}
+
+#include "../../wled00/wled_serial.cpp"
+
+#define RX_CHUNK  128     // bytes arriving between two loop() calls (ESP32 UART FIFO is 128 bytes)
+
+typedef std::chrono::steady_clock test_clock;
+
+static int failures = 0;
+#define CHECK(c) do { if (!(c)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #c); failures++; } } while (0)
+
+static void addAdalight(std::vector<uint8_t> &s, const std::vector<uint8_t> &px) {
+  uint16_t n = px.size()/3 - 1;
+  uint8_t hi = n >> 8, lo = n & 0xFF;
+  s.insert(s.end(), {'A', 'd', 'a', hi, lo, (uint8_t)(hi ^ lo ^ 0x55)});
+  s.insert(s.end(), px.begin(), px.end());
+}
+
+static void addTPM2(std::vector<uint8_t> &s, const std::vector<uint8_t> &px) {
+  uint16_t n = px.size();
+  s.insert(s.end(), {0xC9, 0xDA, (uint8_t)(n >> 8), (uint8_t)(n & 0xFF)});
+  s.insert(s.end(), px.begin(), px.end());
+  s.push_back(0x36);
+}
+
+// feeds stream in chunks, calling handleSerial() after each like loop() does; returns ns spent in handleSerial()
+static unsigned long feed(const std::vector<uint8_t> &s, size_t chunk) {
+  Serial.rx = s.data(); Serial.rxLen = s.size(); Serial.rxPos = Serial.rxAvail = 0;
+  unsigned long ns = 0;
+  while (Serial.rxPos < Serial.rxLen) {
+    Serial.rxAvail = MIN(Serial.rxAvail + chunk, Serial.rxLen);
+    size_t pos = Serial.rxPos;
+    test_clock::time_point t = test_clock::now();
+    handleSerial();
+    ns += std::chrono::duration_cast<std::chrono::nanoseconds>(test_clock::now() - t).count();
+    if (Serial.rxPos == pos) { printf("FAIL handleSerial() stalled at byte %zu\n", pos); failures++; break; } // would spin in loop()
+  }
+  return ns;
+}
+
+static std::vector<uint8_t> randomFrame(uint16_t pixels) {
+  std::vector<uint8_t> px(pixels*3);
+  for (auto &b : px) b = rand();
+  return px;
+}
+
+// frames of different length, both protocols, garbage and unsupported TPM2 packets in between
+static void testFrames(size_t chunk) {
+  std::vector<std::vector<uint8_t>> sent;
+  std::vector<uint8_t> stream;
+  const uint16_t lengths[] = {1, 2, 63, 64, 65, 300, 1024};
+  for (int n = 0; n < 40; n++) {
+    sent.push_back(randomFrame(lengths[n % 7]));
+    if (n & 1) addTPM2(stream, sent.back());
+    else       addAdalight(stream, sent.back());
+    if (n % 5 == 0) stream.insert(stream.end(), {'x', 'A', 'd', 'q', 0xC9, 0x55}); // noise, broken headers
+  }
+  shownFrames.clear();
+  feed(stream, chunk);
+  CHECK(shownFrames.size() == sent.size());
+  for (size_t i = 0; i < sent.size() && i < shownFrames.size(); i++) {
+    if (shownFrames[i] != sent[i]) { printf("FAIL chunk %zu: frame %zu differs\n", chunk, i); failures++; }
+  }
+}
+
+static void bench(bool tpm2) {
+  const uint16_t pixels = 1000;
+  std::vector<uint8_t> stream;
+  for (int n = 0; n < 200; n++) tpm2 ? addTPM2(stream, randomFrame(pixels)) : addAdalight(stream, randomFrame(pixels));
+  shownFrames.clear();
+  unsigned long ns = feed(stream, RX_CHUNK);
+  CHECK(shownFrames.size() == 200);
+  printf("%s %u px frames: %.1f MB/s (%.0f ns per %u byte chunk)\n", tpm2 ? "TPM2    " : "Adalight", pixels,
+         stream.size() * 1e3 / ns, (double)ns * RX_CHUNK / stream.size(), RX_CHUNK);
+}
+
+int main() {
+  srand(1);
+  const size_t chunks[] = {1, 2, 3, 7, RX_CHUNK, 100000};
+  for (size_t c : chunks) testFrames(c);
+  bench(false);
+  bench(true);
+  printf(failures ? "%d failures\n" : "all tests passed\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,16 @@
+// minimal Arduino.h replacement for host builds of wled_math.cpp
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <math.h>
+#include <cmath>
+
+#define PI      3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI  6.283185307179586476925286766559
+
+#define PROGMEM
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+
+#endif
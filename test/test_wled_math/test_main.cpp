@@ -0,0 +1,90 @@
+/*
+ * Host test of the fixed point functions in wled_math.cpp
+ * Compares sin_fixed/cos_fixed/atan2_fixed/sqrt_fixed/hypot_fixed with libm (double) and checks
+ * the error bounds documented in wled_math.cpp. Arduino.h of this directory replaces the real one.
+ *
+ * Build & run: g++ -std=c++11 -O2 -I test/test_wled_math test/test_wled_math/test_main.cpp -o math_test && ./math_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../wled00/wled_math.cpp"
+
+static int failures = 0;
+#define CHECK(c) do { if (!(c)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #c); failures++; } } while (0)
+
+// random 32 bit value (rand() may have only 15 bits)
+static uint32_t rnd32() {
+  return ((uint32_t)rand() << 30) ^ ((uint32_t)rand() << 15) ^ (uint32_t)rand();
+}
+
+static void testSinCos() {
+  double maxSin = 0, maxCos = 0;
+  for (uint32_t a = 0; a < 65536; a++) {
+    double phi = a * TWO_PI / 65536.0;
+    maxSin = fmax(maxSin, fabs(sin_fixed(a) - 32767.0 * sin(phi)));
+    maxCos = fmax(maxCos, fabs(cos_fixed(a) - 32767.0 * cos(phi)));
+  }
+  printf("sin_fixed max error %.2f LSB, cos_fixed %.2f LSB\n", maxSin, maxCos);
+  CHECK(maxSin < 2.0);
+  CHECK(maxCos < 2.0);
+  CHECK(sin_fixed(0) == 0 && sin_fixed(16384) == 32767 && sin_fixed(32768) == 0 && sin_fixed(49152) == -32767);
+}
+
+// error in angle units, wrapping around the full circle
+static double angleError(uint16_t res, int32_t y, int32_t x) {
+  double ref = atan2((double)y, (double)x) * 65536.0 / TWO_PI;
+  double d = fmod(res - ref, 65536.0);
+  if (d >  32768) d -= 65536;
+  if (d < -32768) d += 65536;
+  return fabs(d);
+}
+
+static void testAtan2() {
+  double maxErr = 0;
+  for (int32_t y = -300; y <= 300; y++)       // every direction of a small grid
+    for (int32_t x = -300; x <= 300; x++)
+      if (x || y) maxErr = fmax(maxErr, angleError(atan2_fixed(y, x), y, x));
+  for (int n = 0; n < 1000000; n++) {         // large coordinates (scaled down internally)
+    int32_t y = (int32_t)rnd32(), x = (int32_t)rnd32();
+    if (y == INT32_MIN || x == INT32_MIN || (!x && !y)) continue;
+    maxErr = fmax(maxErr, angleError(atan2_fixed(y, x), y, x));
+  }
+  printf("atan2_fixed max error %.2f angle units\n", maxErr);
+  CHECK(maxErr < 2.0);
+  CHECK(atan2_fixed(0, 0) == 0);
+  CHECK(atan2_fixed(0, 1) == 0 && atan2_fixed(1, 0) == 16384 && atan2_fixed(0, -1) == 32768 && atan2_fixed(-1, 0) == 49152);
+}
+
+static bool isFloorSqrt(uint32_t x, uint32_t r) {
+  return (uint64_t)r * r <= x && (uint64_t)(r + 1) * (r + 1) > x;
+}
+
+static void testSqrt() {
+  for (uint32_t x = 0; x < (1UL << 20); x++) if (!isFloorSqrt(x, sqrt_fixed(x))) { printf("sqrt_fixed(%u) = %u\n", x, sqrt_fixed(x)); failures++; break; }
+  for (int n = 0; n < 1000000; n++) {
+    uint32_t x = rnd32();
+    if (!isFloorSqrt(x, sqrt_fixed(x))) { printf("sqrt_fixed(%u) = %u\n", x, sqrt_fixed(x)); failures++; break; }
+  }
+  CHECK(sqrt_fixed(0xFFFFFFFFUL) == 65535);
+}
+
+static void testHypot() {
+  for (int n = 0; n < 1000000; n++) {
+    int32_t x = (int32_t)(rnd32() % 92681) - 46340, y = (int32_t)(rnd32() % 92681) - 46340;
+    uint16_t r = hypot_fixed(x, y);
+    if (r != (uint16_t)floor(sqrt((double)x*x + (double)y*y))) { printf("hypot_fixed(%d,%d) = %u\n", x, y, r); failures++; break; }
+  }
+  CHECK(hypot_fixed(46340, 46340) == 65534);
+  CHECK(hypot_fixed(-3, 4) == 5);
+}
+
+int main() {
+  srand(1);
+  testSinCos();
+  testAtan2();
+  testSqrt();
+  testHypot();
+  printf(failures ? "%d failures\n" : "all tests passed\n", failures);
+  return failures ? 1 : 0;
+}
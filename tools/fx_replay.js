@@ -0,0 +1,136 @@
+/**
+ * Deterministic effect replay: renders effects on a WLED device (built with WLED_ENABLE_FX_REPLAY)
+ * with a fixed clock and random seed and compares every frame with stored golden frames.
+ * How to use it?
+ *
+ * > node tools/fx_replay.js <host> [options]
+ *
+ *   --fx 1-186          effect id or range to render (default: all)
+ *   --frames 30         frames per effect
+ *   --dt 25             simulated time between frames (ms)
+ *   --seed 1337         random16 seed
+ *   --seq 10:sx:200,..  parameter changes (frame:key:value, keys as in effect defaults: sx, ix, c1, pal, ...)
+ *   --dump              store raw pixels (required for --tol)
+ *   --tol 2             accept frames whose channels differ by at most this value (lossy optimisations)
+ *   --golden file.bin   golden frames (default: replay_golden.bin), created if missing
+ *   --update            overwrite golden frames with current output
+ *
+ * Segment configuration (size, colors, palette) is taken from the device's main segment.
+ * File layout is described in wled00/fx_replay.cpp.
+ */
+
+const fs = require("fs");
+
+const FX_REPLAY_VERSION = 2;
+
+function parseArgs(argv) {
+  const opt = { fx: [0, 255], frames: 30, dt: 25, seed: 1337, seq: [], dump: false, tol: 0, golden: "replay_golden.bin", update: false };
+  for (let i = 0; i < argv.length; i++) {
+    switch (argv[i]) {
+      case "--fx":     opt.fx = argv[++i].split("-").map(Number); if (opt.fx.length < 2) opt.fx.push(opt.fx[0]); break;
+      case "--frames": opt.frames = Number(argv[++i]); break;
+      case "--dt":     opt.dt = Number(argv[++i]); break;
+      case "--seed":   opt.seed = Number(argv[++i]); break;
+      case "--seq":    opt.seq = argv[++i].split(",").map(s => s.split(":")).map(([f, k, v]) => [Number(f), k, Number(v)]); break;
+      case "--dump":   opt.dump = true; break;
+      case "--tol":    opt.tol = Number(argv[++i]); opt.dump = true; break;
+      case "--golden": opt.golden = argv[++i]; break;
+      case "--update": opt.update = true; break;
+      default:         opt.host = argv[i];
+    }
+  }
+  return opt;
+}
+
+function parseReplay(buf) {
+  if (buf.length < 18 || buf.toString("ascii", 0, 3) !== "WFR" || buf.readUInt8(3) !== FX_REPLAY_VERSION) throw new Error("not a replay file (or older version)");
+  const res = { id: buf.readUInt32LE(4), dump: buf.readUInt8(8) & 1, frames: buf.readUInt16LE(9), pixels: buf.readUInt16LE(11),
+                dt: buf.readUInt16LE(13), seed: buf.readUInt16LE(15), steps: buf.readUInt8(17), fx: new Map() };
+  let pos = 18 + 4 * res.steps;
+  if (buf.length < pos) throw new Error("truncated replay file");
+  res.seq = buf.toString("hex", 18, pos); // parameter changes as stored by device (parameter index, not name)
+  const frameLen = (res.dump ? res.pixels * 4 : 0) + 4;
+  while (pos + 1 + res.frames * frameLen <= buf.length) {
+    const id = buf.readUInt8(pos++);
+    const frames = [];
+    for (let f = 0; f < res.frames; f++, pos += frameLen) {
+      frames.push({ hash: buf.readUInt32LE(pos + frameLen - 4), pixels: res.dump ? buf.subarray(pos, pos + frameLen - 4) : null });
+    }
+    res.fx.set(id, frames);
+  }
+  return res;
+}
+
+// largest difference of any color channel between two pixel dumps
+function maxDelta(a, b) {
+  let d = 0;
+  for (let i = 0; i < a.length; i++) d = Math.max(d, Math.abs(a[i] - b[i]));
+  return d;
+}
+
+async function run(opt) {
+  const id = Date.now() >>> 0;
+  const replay = { id, fx: opt.fx, n: opt.frames, dt: opt.dt, seed: opt.seed, dump: opt.dump, seq: opt.seq };
+  const res = await fetch(`http://${opt.host}/json/state`, { method: "POST", headers: { "Content-Type": "application/json" }, body: JSON.stringify({ replay }) });
+  if (!res.ok) throw new Error(`request failed: ${res.status}`);
+
+  // replay runs in device main loop, poll until file with our id appears
+  for (let t = 0; t < 600; t++) {
+    await new Promise(r => setTimeout(r, 500));
+    const r = await fetch(`http://${opt.host}/replay.bin`);
+    if (!r.ok) continue;
+    const buf = Buffer.from(await r.arrayBuffer());
+    if (buf.length >= 8 && buf.readUInt32LE(4) === id) return buf;
+  }
+  throw new Error("timeout waiting for replay");
+}
+
+// results of runs with different parameters cannot be compared
+function checkParams(cur, ref, what) {
+  for (const k of ["frames", "pixels", "dt", "seed", "seq"]) {
+    if (cur[k] !== ref[k]) throw new Error(`${what} differs in ${k}: ${cur[k]} (current) vs ${ref[k]}`);
+  }
+}
+
+function compare(cur, gold, tol) {
+  let ok = 0, tolerated = 0, failed = 0;
+  for (const [fx, frames] of cur.fx) {
+    const golden = gold.fx.get(fx);
+    if (!golden) { console.error(`FX ${fx}: no golden frames`); failed += frames.length; continue; }
+    const bad = [];
+    frames.forEach((f, i) => {
+      const g = golden[i];
+      if (g && f.hash === g.hash) { ok++; return; }
+      if (g && tol > 0 && f.pixels && g.pixels && f.pixels.length === g.pixels.length && maxDelta(f.pixels, g.pixels) <= tol) { tolerated++; return; }
+      failed++;
+      bad.push(i);
+    });
+    if (bad.length) console.error(`FX ${fx}: ${bad.length} frame(s) differ (first: ${bad[0]})`);
+  }
+  console.info(`${ok} identical, ${tolerated} within tolerance, ${failed} different`);
+  return failed === 0;
+}
+
+async function main() {
+  const opt = parseArgs(process.argv.slice(2));
+  if (!opt.host) {
+    console.error("Usage: node tools/fx_replay.js <host> [--fx a-b] [--frames n] [--dt ms] [--seed s] [--seq f:key:val,...] [--dump] [--tol n] [--golden file] [--update]");
+    process.exit(1);
+  }
+  const buf = await run(opt);
+  const cur = parseReplay(buf);
+  console.info(`${cur.fx.size} effects, ${cur.frames} frames, ${cur.pixels} pixels`);
+  // device limits parameters, make sure it ran what was requested
+  if (cur.frames !== opt.frames || cur.dt !== opt.dt || cur.seed !== (opt.seed & 0xFFFF)) throw new Error("device did not run with the requested --frames/--dt/--seed");
+  if (cur.steps !== opt.seq.length) throw new Error("device rejected some --seq steps (unknown parameter or more than 8)");
+  if (opt.update || !fs.existsSync(opt.golden)) {
+    fs.writeFileSync(opt.golden, buf);
+    console.info(`golden frames written to ${opt.golden}`);
+    return;
+  }
+  const gold = parseReplay(fs.readFileSync(opt.golden));
+  checkParams(cur, gold, `golden file ${opt.golden}`);
+  if (!compare(cur, gold, opt.tol)) process.exit(2);
+}
+
+main().catch(e => { console.error(e.message); process.exit(1); });
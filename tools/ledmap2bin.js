@@ -0,0 +1,40 @@
+/**
+ * Converts ledmapX.json into compact binary ledmapX.bin
+ * How to use it?
+ *
+ * > node tools/ledmap2bin.js ledmap.json [ledmap.bin]
+ *
+ * Upload resulting file to WLED using /edit page. Binary ledmap takes precedence over JSON ledmap
+ * with the same number and is read directly into mapping table (no JSON parsing on device).
+ * Uploading ledmapX.json through /upload removes stale ledmapX.bin.
+ *
+ * File layout (little endian):
+ *   3 bytes "WLM", 1 byte version (1), uint16 entry count, entry count * uint16 (0xFFFF = no LED)
+ */
+
+const fs = require("fs");
+
+const LEDMAP_BIN_VERSION = 1;
+
+function convert(src, dst) {
+  const json = JSON.parse(fs.readFileSync(src, "utf8"));
+  const map = json.map;
+  if (!Array.isArray(map) || map.length === 0) throw new Error(`${src}: missing or empty "map" array`);
+  if (map.length > 0xFFFF) throw new Error(`${src}: too many entries (${map.length})`);
+
+  const buf = Buffer.alloc(6 + map.length * 2);
+  buf.write("WLM", 0, "ascii");
+  buf.writeUInt8(LEDMAP_BIN_VERSION, 3);
+  buf.writeUInt16LE(map.length, 4);
+  map.forEach((v, i) => buf.writeUInt16LE((v < 0 || v > 0xFFFF) ? 0xFFFF : v, 6 + i * 2));
+
+  fs.writeFileSync(dst, buf);
+  console.info(`${src} -> ${dst}: ${map.length} entries, ${buf.length} bytes`);
+}
+
+const args = process.argv.slice(2);
+if (args.length < 1) {
+  console.error("Usage: node tools/ledmap2bin.js <ledmap.json> [ledmap.bin]");
+  process.exit(1);
+}
+convert(args[0], args[1] || args[0].replace(/\.json$/i, "") + ".bin");
@@ -90,7 +90,7 @@ class QuinLEDAnPentaUsermod : public Usermod
       for (int8_t b = 0; b < numBusses; b++) {
         Bus* curBus = busses.getBus(b);
         if (curBus != nullptr) {
-          uint8_t pins[5] = {0, 0, 0, 0, 0};
+          uint8_t pins[WLED_MAX_BUS_PINS] = {0};
           currentBussesNumPins[b] = curBus->getPins(pins);
           for (int8_t p = 0; p < currentBussesNumPins[b]; p++) {
             if (isAnPentaLedPin(pins[p])) {
@@ -2092,8 +2092,10 @@ static const char _data_FX_MODE_BPM[] PROGMEM = "Bpm@!;!;!;;sx=64";
 uint16_t mode_fillnoise8() {
   if (SEGENV.call == 0) SEGENV.step = random16(12345);
   //CRGB fastled_col;
+  uint8_t noise[32]; // noise is generated in chunks to limit stack use
   for (int i = 0; i < SEGLEN; i++) {
-    uint8_t index = inoise8(i * SEGLEN, SEGENV.step + i * SEGLEN);
+    if (i % sizeof(noise) == 0) inoise8_line(noise, MIN((int)sizeof(noise), SEGLEN - i), i * SEGLEN, SEGLEN, SEGENV.step + i * SEGLEN, SEGLEN);
+    uint8_t index = noise[i % sizeof(noise)];
     //fastled_col = ColorFromPalette(SEGPALETTE, index, 255, LINEARBLEND);
     //SEGMENT.setPixelColor(i, fastled_col.red, fastled_col.green, fastled_col.blue);
     SEGMENT.setPixelColor(i, SEGMENT.color_from_palette(index, false, PALETTE_SOLID_WRAP, 0));
@@ -4021,8 +4023,10 @@ uint16_t mode_noisepal(void) {                                    // Slow noise
 
   if (SEGMENT.palette > 0) palettes[0] = SEGPALETTE;
 
+  uint8_t noise[32]; // noise is generated in chunks to limit stack use
   for (int i = 0; i < SEGLEN; i++) {
-    uint8_t index = inoise8(i*scale, SEGENV.aux0+i*scale);                // Get a value from the noise function. I'm using both x and y axis.
+    if (i % sizeof(noise) == 0) inoise8_line(noise, MIN((int)sizeof(noise), SEGLEN - i), i*scale, scale, SEGENV.aux0+i*scale, scale);
+    uint8_t index = noise[i % sizeof(noise)];                             // Get a value from the noise function. I'm using both x and y axis.
     color = ColorFromPalette(palettes[0], index, 255, LINEARBLEND);       // Use the my own palette.
     SEGMENT.setPixelColor(i, color.red, color.green, color.blue);
   }
@@ -4872,9 +4876,11 @@ uint16_t mode_2Dfirenoise(void) {               // firenoise2d. By Andrew Tuline
                                                                   CRGB::DarkOrange,CRGB::DarkOrange, CRGB::Orange, CRGB::Orange,
                                                                   CRGB::Yellow,    CRGB::Orange,     CRGB::Yellow, CRGB::Yellow);
 
+  uint8_t noise[rows];
   for (int j=0; j < cols; j++) {
+    inoise8_line(noise, rows, j*yscale*rows/255, 0, strip.now/4, xscale);                                       // We're moving along our Perlin map.
     for (int i=0; i < rows; i++) {
-      indexx = inoise8(j*yscale*rows/255, i*xscale+strip.now/4);                                               // We're moving along our Perlin map.
+      indexx = noise[i];
       SEGMENT.setPixelColorXY(j, i, ColorFromPalette(pal, min(i*(indexx)>>4, 255U), i*255/cols, LINEARBLEND)); // With that value, look up the 8 bit colour palette value and assign it to the current LED.
     } // for i
   } // for j
@@ -4909,108 +4915,182 @@ static const char _data_FX_MODE_2DFRIZZLES[] PROGMEM = "Frizzles@X frequency,Y f
 ///////////////////////////////////////////
 //   2D Cellular Automata Game of life   //
 ///////////////////////////////////////////
-typedef struct ColorCount {
-  CRGB color;
-  int8_t count;
-} colorCount;
+// Cell state is kept in two bit planes (one bit per cell, 32 cells per word) that are swapped each
+// generation. Neighbours are counted 32 cells at a time using bit-sliced counters and a separate
+// colour plane holds palette index of each cell (so it is not lost through lossy getPixelColorXY()).
+// Rule can be set using segment name in B/S notation (e.g. "B36/S23" for HighLife), default is B3/S23.
+#define GOL_DEFAULT_BIRTH   0x0008  // B3
+#define GOL_DEFAULT_SURVIVE 0x000C  // S23
+#define GOL_CRC_LEN         2       // number of previous generations checked for repetition
+
+typedef struct GameOfLife {
+  uint16_t cols, rows;
+  uint16_t birth, survive;          // bit k is set if cell is born/survives with k neighbours
+  uint16_t crc[GOL_CRC_LEN];
+} gol_t;
+
+// parses "B3/S23" style rule (case insensitive, any order); returns false if string is not a rule
+static bool parseLifeRule(const char *str, uint16_t &birth, uint16_t &survive) {
+  if (!str) return false;
+  uint16_t b = 0, s = 0, *cur = nullptr;
+  bool hasB = false, hasS = false;
+  for (; *str; str++) {
+    char c = toupper(*str);
+    if      (c == 'B') { cur = &b; hasB = true; }
+    else if (c == 'S') { cur = &s; hasS = true; }
+    else if (c >= '0' && c <= '8' && cur) *cur |= 1 << (c - '0');
+    else if (c != '/' && c != ' ') return false;
+  }
+  if (!hasB || !hasS) return false;
+  birth   = b;
+  survive = s;
+  return true;
+}
+
+// bit i of result holds state of west (x-1) or east (x+1) neighbour of cell x=32*w+i (wrapping around)
+static inline uint32_t lifeWest(const uint32_t *row, unsigned w, unsigned cols) {
+  const unsigned last = cols - 1;
+  return (row[w] << 1) | (w > 0 ? row[w-1] >> 31 : (row[last >> 5] >> (last & 31)) & 1);
+}
+static inline uint32_t lifeEast(const uint32_t *row, unsigned w, unsigned words, unsigned cols) {
+  return (row[w] >> 1) | (w+1 < words ? row[w+1] << 31 : (row[0] & 1) << ((cols - 1) & 31));
+}
+
+// adds one neighbour word into 4 bit-sliced counters (s3:s2:s1:s0 = count for each of 32 cells)
+static inline void lifeAdd(uint32_t v, uint32_t &s0, uint32_t &s1, uint32_t &s2, uint32_t &s3) {
+  uint32_t c0 = s0 & v;  s0 ^= v;
+  uint32_t c1 = s1 & c0; s1 ^= c0;
+  uint32_t c2 = s2 & c1; s2 ^= c1;
+  s3 |= c2;
+}
+
+// most frequent colour among live neighbours of a cell (random colour if there are none)
+static uint8_t lifeDominantColor(const uint32_t *plane, const uint8_t *colors, unsigned x, unsigned y, unsigned cols, unsigned rows, unsigned words) {
+  uint8_t idx[8];
+  unsigned n = 0;
+  for (int j = -1; j <= 1; j++) for (int i = -1; i <= 1; i++) {
+    if (i == 0 && j == 0) continue;
+    unsigned xx = (x + cols + i) % cols;
+    unsigned yy = (y + rows + j) % rows;
+    if ((plane[yy*words + (xx >> 5)] >> (xx & 31)) & 1) idx[n++] = colors[yy*cols + xx];
+  }
+  if (n == 0) return random8();
+  uint8_t dominant = idx[0];
+  unsigned maxCount = 0;
+  for (unsigned a = 0; a < n; a++) {
+    unsigned count = 0;
+    for (unsigned b = 0; b < n; b++) if (idx[b] == idx[a]) count++;
+    if (count > maxCount) { maxCount = count; dominant = idx[a]; }
+  }
+  return dominant;
+}
 
 uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https://natureofcode.com/book/chapter-7-cellular-automata/ and https://github.com/DougHaber/nlife-color
   if (!strip.isMatrix) return mode_static(); // not a 2D set-up
 
   const uint16_t cols = SEGMENT.virtualWidth();
   const uint16_t rows = SEGMENT.virtualHeight();
-  const uint16_t dataSize = sizeof(CRGB) * SEGMENT.length();  // using width*height prevents reallocation if mirroring is enabled
-  const uint16_t crcBufferLen = 2; //(SEGMENT.width() + SEGMENT.height())*71/100; // roughly sqrt(2)/2 for better repetition detection (Ewowi)
+  const unsigned words = (cols + 31) >> 5;    // words per row
+  const size_t planeSize = words * rows;      // in words
+  const uint32_t lastMask = (cols & 31) ? (1UL << (cols & 31)) - 1 : 0xFFFFFFFFUL;
 
-  if (!SEGENV.allocateData(dataSize + sizeof(uint16_t)*crcBufferLen)) return mode_static(); //allocation failed
-  CRGB *prevLeds = reinterpret_cast<CRGB*>(SEGENV.data);
-  uint16_t *crcBuffer = reinterpret_cast<uint16_t*>(SEGENV.data + dataSize); 
+  if (!SEGENV.allocateData(sizeof(gol_t) + 2 * planeSize * sizeof(uint32_t) + cols * rows)) return mode_static(); //allocation failed
+  gol_t    *gol    = reinterpret_cast<gol_t*>(SEGENV.data);
+  uint32_t *planes = reinterpret_cast<uint32_t*>(SEGENV.data + sizeof(gol_t));
+  uint8_t  *colors = reinterpret_cast<uint8_t*>(planes + 2 * planeSize); // palette index of each cell
+  uint32_t *cur    = planes + (SEGENV.aux1 & 1) * planeSize;
+  uint32_t *nxt    = planes + (~SEGENV.aux1 & 1) * planeSize;
 
-  CRGB backgroundColor = SEGCOLOR(1);
+  uint32_t bgc = SEGCOLOR(1);
 
-  if (SEGENV.call == 0 || strip.now - SEGMENT.step > 3000) {
+  if (SEGENV.call == 0 || gol->cols != cols || gol->rows != rows || strip.now - SEGMENT.step > 3000) {
     SEGENV.step = strip.now;
     SEGENV.aux0 = 0;
+    gol->cols = cols;
+    gol->rows = rows;
+    memset(gol->crc, 0, sizeof(gol->crc));
     random16_set_seed(millis()>>2); //seed the random generator
 
-    //give the leds random state and colors (based on intensity, colors from palette or all posible colors are chosen)
-    for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) {
-      uint8_t state = random8()%2;
-      if (state == 0)
-        SEGMENT.setPixelColorXY(x,y, backgroundColor);
-      else
-        SEGMENT.setPixelColorXY(x,y, SEGMENT.color_from_palette(random8(), false, PALETTE_SOLID_WRAP, 255));
+    //give the leds random state and colors (colors from palette)
+    memset(cur, 0, planeSize * sizeof(uint32_t));
+    for (unsigned y = 0; y < rows; y++) for (unsigned x = 0; x < cols; x++) {
+      if (random8()%2) {
+        cur[y*words + (x >> 5)] |= 1UL << (x & 31);
+        colors[y*cols + x] = random8();
+        SEGMENT.setPixelColorXY(x, y, SEGMENT.color_from_palette(colors[y*cols + x], false, PALETTE_SOLID_WRAP, 255));
+      } else
+        SEGMENT.setPixelColorXY(x, y, bgc);
     }
-
-    for (int y = 0; y < rows; y++) for (int x = 0; x < cols; x++) prevLeds[XY(x,y)] = CRGB::Black;
-    memset(crcBuffer, 0, sizeof(uint16_t)*crcBufferLen);
   } else if (strip.now - SEGENV.step < FRAMETIME_FIXED * (uint32_t)map(SEGMENT.speed,0,255,64,4)) {
     // update only when appropriate time passes (in 42 FPS slots)
     return FRAMETIME;
   }
 
-  //copy previous leds (save previous generation)
-  //NOTE: using lossy getPixelColor() is a benefit as endlessly repeating patterns will eventually fade out causing a reset
-  for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) prevLeds[XY(x,y)] = SEGMENT.getPixelColorXY(x,y);
-
-  //calculate new leds
-  for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) {
-
-    colorCount colorsCount[9]; // count the different colors in the 3*3 matrix
-    for (int i=0; i<9; i++) colorsCount[i] = {backgroundColor, 0}; // init colorsCount
-
-    // iterate through neighbors and count them and their different colors
-    int neighbors = 0;
-    for (int i = -1; i <= 1; i++) for (int j = -1; j <= 1; j++) { // iterate through 3*3 matrix
-      if (i==0 && j==0) continue; // ignore itself
-      // wrap around segment
-      int16_t xx = x+i, yy = y+j;
-      if (x+i < 0) xx = cols-1; else if (x+i >= cols) xx = 0;
-      if (y+j < 0) yy = rows-1; else if (y+j >= rows) yy = 0;
-
-      uint16_t xy = XY(xx, yy); // previous cell xy to check
-      // count different neighbours and colors
-      if (prevLeds[xy] != backgroundColor) {
-        neighbors++;
-        bool colorFound = false;
-        int k;
-        for (k=0; k<9 && colorsCount[i].count != 0; k++)
-          if (colorsCount[k].color == prevLeds[xy]) {
-            colorsCount[k].count++;
-            colorFound = true;
-          }
-        if (!colorFound) colorsCount[k] = {prevLeds[xy], 1}; //add new color found in the array
+  gol->birth   = GOL_DEFAULT_BIRTH;
+  gol->survive = GOL_DEFAULT_SURVIVE;
+  parseLifeRule(SEGMENT.name, gol->birth, gol->survive);
+  const uint16_t rules = gol->birth | gol->survive;
+
+  //calculate next generation, 32 cells at a time; only changed cells are redrawn
+  for (unsigned y = 0; y < rows; y++) {
+    const uint32_t *up  = cur + ((y + rows - 1) % rows) * words;
+    const uint32_t *mid = cur + y * words;
+    const uint32_t *dn  = cur + ((y + 1) % rows) * words;
+    for (unsigned w = 0; w < words; w++) {
+      uint32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+      lifeAdd(up[w],                         s0, s1, s2, s3);
+      lifeAdd(lifeWest(up, w, cols),         s0, s1, s2, s3);
+      lifeAdd(lifeEast(up, w, words, cols),  s0, s1, s2, s3);
+      lifeAdd(lifeWest(mid, w, cols),        s0, s1, s2, s3);
+      lifeAdd(lifeEast(mid, w, words, cols), s0, s1, s2, s3);
+      lifeAdd(dn[w],                         s0, s1, s2, s3);
+      lifeAdd(lifeWest(dn, w, cols),         s0, s1, s2, s3);
+      lifeAdd(lifeEast(dn, w, words, cols),  s0, s1, s2, s3);
+
+      // Rules of Life
+      const uint32_t alive = mid[w];
+      uint32_t res = 0;
+      for (unsigned k = 0; k <= 8; k++) {
+        if (!((rules >> k) & 1)) continue;
+        uint32_t eq = (k & 1 ? s0 : ~s0) & (k & 2 ? s1 : ~s1) & (k & 4 ? s2 : ~s2) & (k & 8 ? s3 : ~s3);
+        if ((gol->birth   >> k) & 1) res |= eq & ~alive; // Reproduction
+        if ((gol->survive >> k) & 1) res |= eq &  alive; // Survival (otherwise Loneliness or Overpopulation)
+      }
+      uint32_t mutate  = ~s0 & s1 & ~s2 & ~s3 & ~alive & ~res; // dead cells with 2 neighbours
+      uint32_t changed = (res ^ alive) | mutate;
+      if (w == words - 1) { res &= lastMask; changed &= lastMask; }
+
+      while (changed) {
+        const unsigned i = __builtin_ctz(changed);
+        const uint32_t bit = 1UL << i;
+        const unsigned x = (w << 5) + i;
+        changed &= changed - 1;
+        if (res & bit & ~alive) {
+          // assign the dominant color w/ a bit of randomness to avoid "gliders"
+          if (!random8(128)) { res &= ~bit; continue; }
+          colors[y*cols + x] = lifeDominantColor(cur, colors, x, y, cols, rows, words);
+        } else if (mutate & bit) {
+          if (random8(128)) continue;
+          res |= bit;                                                           // Mutation
+          colors[y*cols + x] = random8();
+        }
+        SEGMENT.setPixelColorXY(x, y, (res & bit) ? SEGMENT.color_from_palette(colors[y*cols + x], false, PALETTE_SOLID_WRAP, 255) : bgc);
       }
-    } // i,j
-
-    // Rules of Life
-    uint32_t col = uint32_t(prevLeds[XY(x,y)]) & 0x00FFFFFF;  // uint32_t operator returns RGBA, we want RGBW -> cut off "alpha" byte
-    uint32_t bgc = RGBW32(backgroundColor.r, backgroundColor.g, backgroundColor.b, 0);
-    if      ((col != bgc) && (neighbors <  2)) SEGMENT.setPixelColorXY(x,y, bgc); // Loneliness
-    else if ((col != bgc) && (neighbors >  3)) SEGMENT.setPixelColorXY(x,y, bgc); // Overpopulation
-    else if ((col == bgc) && (neighbors == 3)) {                                  // Reproduction
-      // find dominant color and assign it to a cell
-      colorCount dominantColorCount = {backgroundColor, 0};
-      for (int i=0; i<9 && colorsCount[i].count != 0; i++)
-        if (colorsCount[i].count > dominantColorCount.count) dominantColorCount = colorsCount[i];
-      // assign the dominant color w/ a bit of randomness to avoid "gliders"
-      if (dominantColorCount.count > 0 && random8(128)) SEGMENT.setPixelColorXY(x,y, dominantColorCount.color);
-    } else if ((col == bgc) && (neighbors == 2) && !random8(128)) {               // Mutation
-      SEGMENT.setPixelColorXY(x,y, SEGMENT.color_from_palette(random8(), false, PALETTE_SOLID_WRAP, 255));
-    }
-    // else do nothing!
-  } //x,y
-
-  // calculate CRC16 of leds
-  uint16_t crc = crc16((const unsigned char*)prevLeds, dataSize);
+      nxt[y*words + w] = res;
+    }
+  }
+  SEGENV.aux1 ^= 1; // swap planes
+
+  // calculate CRC16 of new generation
+  uint16_t crc = crc16((const unsigned char*)nxt, planeSize * sizeof(uint32_t));
   // check if we had same CRC and reset if needed
   bool repetition = false;
-  for (int i=0; i<crcBufferLen && !repetition; i++) repetition = (crc == crcBuffer[i]); // (Ewowi)
+  for (int i=0; i<GOL_CRC_LEN && !repetition; i++) repetition = (crc == gol->crc[i]); // (Ewowi)
   // same CRC would mean image did not change or was repeating itself
   if (!repetition) SEGENV.step = strip.now; //if no repetition avoid reset
   // remember CRCs across frames
-  crcBuffer[SEGENV.aux0] = crc;
-  ++SEGENV.aux0 %= crcBufferLen;
+  gol->crc[SEGENV.aux0] = crc;
+  ++SEGENV.aux0 %= GOL_CRC_LEN;
 
   return FRAMETIME;
 } // mode_2Dgameoflife()
@@ -5061,9 +5141,6 @@ uint16_t mode_2DJulia(void) {                           // An animated Julia set
   if (!SEGENV.allocateData(sizeof(julia))) return mode_static();
   Julia* julias = reinterpret_cast<Julia*>(SEGENV.data);
 
-  float reAl;
-  float imAg;
-
   if (SEGENV.call == 0) {           // Reset the center if we've just re-started this animation.
     julias->xcen = 0.;
     julias->ycen = 0.;
@@ -5092,48 +5169,42 @@ uint16_t mode_2DJulia(void) {                           // An animated Julia set
   ymin = constrain(ymin, -0.8f, 1.0f);
   ymax = constrain(ymax, -0.8f, 1.0f);
 
-  float dx;                       // Delta x is mapped to the matrix size.
-  float dy;                       // Delta y is mapped to the matrix size.
-
-  int maxIterations = 15;         // How many iterations per pixel before we give up. Make it 8 bits to match our range of colours.
-  float maxCalc = 16.0;           // How big is each calculation allowed to be before we give up.
-
-  maxIterations = SEGMENT.intensity/2;
-
+  int maxIterations = SEGMENT.intensity/2; // How many iterations per pixel before we give up.
+  const int32_t maxCalc = 16 << 16;        // How big is each calculation allowed to be before we give up.
 
+  // per pixel math is done in Q16.16 fixed point (no FPU on some MCUs)
   // Resize section on the fly for some animaton.
-  reAl = -0.94299f;               // PixelBlaze example
-  imAg = 0.3162f;
+  int32_t reAl = -0.94299f * 65536;        // PixelBlaze example
+  int32_t imAg =  0.3162f  * 65536;
 
-  reAl += sin_t((float)millis()/305.f)/20.f;
-  imAg += sin_t((float)millis()/405.f)/20.f;
+  reAl += sin_fixed((millis() * 2188UL) >> 6) / 10; // sin(millis/305)/20
+  imAg += sin_fixed((millis() * 1648UL) >> 6) / 10; // sin(millis/405)/20
 
-  dx = (xmax - xmin) / (cols);     // Scale the delta x and y values to our matrix size.
-  dy = (ymax - ymin) / (rows);
+  int32_t dx = (xmax - xmin) * 65536 / cols;  // Scale the delta x and y values to our matrix size.
+  int32_t dy = (ymax - ymin) * 65536 / rows;
 
   // Start y
-  float y = ymin;
+  int32_t y = ymin * 65536;
   for (int j = 0; j < rows; j++) {
 
     // Start x
-    float x = xmin;
+    int32_t x = xmin * 65536;
     for (int i = 0; i < cols; i++) {
 
       // Now we test, as we iterate z = z^2 + c does z tend towards infinity?
-      float a = x;
-      float b = y;
+      int32_t a = x;
+      int32_t b = y;
       int iter = 0;
 
       while (iter < maxIterations) {    // Here we determine whether or not we're out of bounds.
-        float aa = a * a;
-        float bb = b * b;
-        float len = aa + bb;
-        if (len > maxCalc) {            // |z| = sqrt(a^2+b^2) OR z^2 = a^2+b^2 to save on having to perform a square root.
+        int32_t aa = ((int64_t)a * a) >> 16;
+        int32_t bb = ((int64_t)b * b) >> 16;
+        if (aa + bb > maxCalc) {        // |z| = sqrt(a^2+b^2) OR z^2 = a^2+b^2 to save on having to perform a square root.
           break;  // Bail
         }
 
        // This operation corresponds to z -> z^2+c where z=a+ib c=(x,y). Remember to use 'foil'.
-        b = 2*a*b + imAg;
+        b = (((int64_t)a * b) >> 15) + imAg;
         a = aa - bb + reAl;
         iter++;
       } // while
@@ -5328,9 +5399,11 @@ uint16_t mode_2Dnoise(void) {                  // By Andrew Tuline
 
   const uint16_t scale  = SEGMENT.intensity+2;
 
+  uint8_t noise[cols];
   for (int y = 0; y < rows; y++) {
+    inoise8_line(noise, cols, 0, scale, y * scale, 0, millis() / (16 - SEGMENT.speed/16), 0);
     for (int x = 0; x < cols; x++) {
-      uint8_t pixelHue8 = inoise8(x * scale, y * scale, millis() / (16 - SEGMENT.speed/16));
+      uint8_t pixelHue8 = noise[x];
       SEGMENT.setPixelColorXY(x, y, ColorFromPalette(SEGPALETTE, pixelHue8));
     }
   }
@@ -5351,11 +5424,14 @@ uint16_t mode_2DPlasmaball(void) {                   // By: Stepko https://edito
 
   SEGMENT.fadeToBlackBy(SEGMENT.custom1>>2);
   uint_fast32_t t = (millis() * 8) / (256 - SEGMENT.speed);  // optimized to avoid float
+  uint8_t noiseX[cols], noiseY[rows];                         // noise only depends on column or row
+  inoise8_line(noiseX, cols, 0, 30, t, 0, t, 0);
+  inoise8_line(noiseY, rows, t, 0, 0, 30, t, 0);
   for (int i = 0; i < cols; i++) {
-    uint16_t thisVal = inoise8(i * 30, t, t);
+    uint16_t thisVal = noiseX[i];
     uint16_t thisMax = map(thisVal, 0, 255, 0, cols-1);
     for (int j = 0; j < rows; j++) {
-      uint16_t thisVal_ = inoise8(t, j * 30, t);
+      uint16_t thisVal_ = noiseY[j];
       uint16_t thisMax_ = map(thisVal_, 0, 255, 0, rows-1);
       uint16_t x = (i + thisMax_ - cols / 2);
       uint16_t y = (j + thisMax - cols / 2);
@@ -5416,13 +5492,17 @@ uint16_t mode_2DPolarLights(void) {        // By: Kostyantyn Matviyevskyy  https
   uint16_t _scale = map(SEGMENT.intensity, 0, 255, 30, adjScale);
   byte _speed = map(SEGMENT.speed, 0, 255, 128, 16);
 
+  // vertical distance from center only depends on row, compute it once per frame instead of per pixel
+  uint8_t rowDist[rows];
+  for (int y = 0; y < rows; y++) rowDist[y] = fabsf((float)rows / 2.0f - (float)y) * adjustHeight;
+
   for (int x = 0; x < cols; x++) {
     for (int y = 0; y < rows; y++) {
       SEGENV.step++;
       SEGMENT.setPixelColorXY(x, y, ColorFromPalette(auroraPalette,
                                       qsub8(
                                         inoise8((SEGENV.step%2) + x * _scale, y * 16 + SEGENV.step % 16, SEGENV.step / _speed),
-                                        fabsf((float)rows / 2.0f - (float)y) * adjustHeight)));
+                                        rowDist[y])));
     }
   }
 
@@ -5538,8 +5618,10 @@ uint16_t mode_2DSunradiation(void) {                   // By: ldirko https://edi
   int index = 0;
   uint8_t someVal = SEGMENT.speed/4;             // Was 25.
   for (int j = 0; j < (rows + 2); j++) {
+    int8_t *noise = reinterpret_cast<int8_t*>(bump + index);
+    inoise8_raw_line(noise, cols + 2, 0, someVal, j * someVal, 0, t, 0);
     for (int i = 0; i < (cols + 2); i++) {
-      byte col = (inoise8_raw(i * someVal, j * someVal, t)) / 2;
+      byte col = noise[i] / 2;
       bump[index++] = col;
     }
   }
@@ -5913,6 +5995,14 @@ static const char _data_FX_MODE_2DBLOBS[] PROGMEM = "Blobs@!,# blobs,Blur,Trail;
 ////////////////////////////
 //     2D Scrolling text  //
 ////////////////////////////
+// pre-rendered text of Scrolling Text (followed by mask, see Segment::renderTextMask())
+typedef struct TextCache {
+  uint8_t w, h;     // font
+  int8_t  rotate;
+  uint8_t cellW;    // letter spacing
+  char    text[WLED_MAX_SEGNAME_LEN+1];
+} textcache_t;
+
 uint16_t mode_2Dscrollingtext(void) {
   if (!strip.isMatrix) return mode_static(); // not a 2D set-up
 
@@ -5994,16 +6084,40 @@ uint16_t mode_2Dscrollingtext(void) {
 
   if (!SEGMENT.check2) SEGMENT.fade_out(255 - (SEGMENT.custom1>>4));  // trail
 
-  for (int i = 0; i < numberOfLetters; i++) {
-    int xoffset = int(cols) - int(SEGENV.aux0) + rotLW*i;
-    if (xoffset + rotLW < 0) continue; // don't draw characters off-screen
-    uint32_t col1 = SEGMENT.color_from_palette(SEGENV.aux1, false, PALETTE_SOLID_WRAP, 0);
-    uint32_t col2 = BLACK;
-    if (SEGMENT.check1 && SEGMENT.palette == 0) {
-      col1 = SEGCOLOR(0);
-      col2 = SEGCOLOR(2);
+  uint32_t col1 = SEGMENT.color_from_palette(SEGENV.aux1, false, PALETTE_SOLID_WRAP, 0);
+  uint32_t col2 = BLACK;
+  if (SEGMENT.check1 && SEGMENT.palette == 0) {
+    col1 = SEGCOLOR(0);
+    col2 = SEGCOLOR(2);
+  }
+  const int8_t rotate = map(SEGMENT.custom3, 0, 31, -2, 2);
+  const int xstart = int(cols) - int(SEGENV.aux0);
+
+  // text is pre-rendered into a mask which is only rebuilt when text, font or rotation change
+  const bool rotated = (rotate == 1 || rotate == -1);
+  const uint16_t maskW = numberOfLetters ? (numberOfLetters-1) * rotLW + (rotated ? letterHeight : letterWidth) : 0;
+  const uint16_t maskH = rotated ? letterWidth : letterHeight;
+  const size_t maskSize = Segment::getTextMaskSize(maskW, maskH);
+  if (maskSize && SEGENV.allocateData(sizeof(textcache_t) + maskSize)) {
+    textcache_t *cache = reinterpret_cast<textcache_t*>(SEGENV.data);
+    uint8_t *mask = SEGENV.data + sizeof(textcache_t);
+    if (cache->w != letterWidth || cache->h != letterHeight || cache->rotate != rotate || cache->cellW != rotLW || strcmp(cache->text, text)) {
+      Segment::renderTextMask(text, letterWidth, letterHeight, rotate, rotLW, mask, maskW, maskH);
+      cache->w      = letterWidth;
+      cache->h      = letterHeight;
+      cache->rotate = rotate;
+      cache->cellW  = rotLW;
+      strcpy(cache->text, text);
+    }
+    SEGMENT.drawTextMask(mask, maskW, maskH, xstart, yoffset, letterHeight, col1, col2);
+  } else {
+    // not enough memory for mask: draw character by character
+    for (int i = 0; i < numberOfLetters; i++) {
+      int xoffset = xstart + rotLW*i;
+      if (xoffset + rotLW < 0) continue; // don't draw characters off-screen
+      if (xoffset >= cols) break;
+      SEGMENT.drawCharacter(text[i], xoffset, yoffset, letterWidth, letterHeight, col1, col2, rotate);
     }
-    SEGMENT.drawCharacter(text[i], xoffset, yoffset, letterWidth, letterHeight, col1, col2, map(SEGMENT.custom3, 0, 31, -2, 2));
   }
 
   return FRAMETIME;
@@ -6021,14 +6135,17 @@ uint16_t mode_2Ddriftrose(void) {
   const uint16_t cols = SEGMENT.virtualWidth();
   const uint16_t rows = SEGMENT.virtualHeight();
 
-  const float CX = (cols-cols%2)/2.f - .5f;
-  const float CY = (rows-rows%2)/2.f - .5f;
-  const float L = min(cols, rows) / 2.f;
+  // coordinates are scaled by 255 for wu_pixel()
+  const int CX = ((cols-cols%2) - 1) * 255 / 2;
+  const int CY = ((rows-rows%2) - 1) * 255 / 2;
+  const uint8_t L2 = min(cols, rows); // 2*L
 
   SEGMENT.fadeToBlackBy(32+(SEGMENT.speed>>3));
   for (size_t i = 1; i < 37; i++) {
-    uint32_t x = (CX + (sin_t(radians(i * 10)) * (beatsin8(i, 0, L*2)-L))) * 255.f;
-    uint32_t y = (CY + (cos_t(radians(i * 10)) * (beatsin8(i, 0, L*2)-L))) * 255.f;
+    uint16_t angle = (i * 65536) / 36;      // i * 10 degrees
+    int32_t d = beatsin8(i, 0, L2)*2 - L2;  // 2*(beatsin8()-L)
+    uint32_t x = CX + ((sin_fixed(angle) * d * 255) >> 16);
+    uint32_t y = CY + ((cos_fixed(angle) * d * 255) >> 16);
     SEGMENT.wu_pixel(x, y, CHSV(i * 10, 255, 255));
   }
   SEGMENT.blur((SEGMENT.intensity>>4)+1);
@@ -6228,19 +6345,24 @@ uint16_t mode_2DWaverly(void) {
 
   SEGMENT.fadeToBlackBy(SEGMENT.speed);
 
+  const uint32_t volume = volumeSmth * 256; // Q8 fixed point, avoids float math per column
+
   long t = millis() / 2;
+  uint8_t noise[cols];
+  inoise8_line(noise, cols, 0, 45, t, 0, t, 0);
   for (int i = 0; i < cols; i++) {
-    uint16_t thisVal = (1 + SEGMENT.intensity/64) * inoise8(i * 45 , t , t)/2;
+    uint16_t thisVal = (1 + SEGMENT.intensity/64) * noise[i]/2;
     // use audio if available
     if (um_data) {
       thisVal /= 32; // reduce intensity of inoise8()
-      thisVal *= volumeSmth;
+      thisVal = (thisVal * volume) >> 8;
     }
     uint16_t thisMax = map(thisVal, 0, 512, 0, rows);
 
     for (int j = 0; j < thisMax; j++) {
-      SEGMENT.addPixelColorXY(i, j, ColorFromPalette(SEGPALETTE, map(j, 0, thisMax, 250, 0), 255, LINEARBLEND));
-      SEGMENT.addPixelColorXY((cols - 1) - i, (rows - 1) - j, ColorFromPalette(SEGPALETTE, map(j, 0, thisMax, 250, 0), 255, LINEARBLEND));
+      CRGB c = ColorFromPalette(SEGPALETTE, map(j, 0, thisMax, 250, 0), 255, LINEARBLEND);
+      SEGMENT.addPixelColorXY(i, j, c);
+      SEGMENT.addPixelColorXY((cols - 1) - i, (rows - 1) - j, c);
     }
   }
   SEGMENT.blur(16);
@@ -7590,19 +7712,11 @@ uint16_t mode_2Doctopus() {
 
   const uint16_t cols = SEGMENT.virtualWidth();
   const uint16_t rows = SEGMENT.virtualHeight();
-  const uint8_t mapp = 180 / MAX(cols,rows);
 
-  typedef struct {
-    uint8_t angle;
-    uint8_t radius;
-  } map_t;
-
-  const size_t dataSize = SEGMENT.width() * SEGMENT.height() * sizeof(map_t); // prevent reallocation if mirrored or grouped
-  if (!SEGENV.allocateData(dataSize + 2)) return mode_static(); //allocation failed
-
-  map_t *rMap = reinterpret_cast<map_t*>(SEGENV.data);
-  uint8_t *offsX = reinterpret_cast<uint8_t*>(SEGENV.data + dataSize);
-  uint8_t *offsY = reinterpret_cast<uint8_t*>(SEGENV.data + dataSize + 1);
+  // angle/radius table is provided (and cached) by segment, we only keep offsets to detect change
+  if (!SEGENV.allocateData(2)) return mode_static(); //allocation failed
+  uint8_t *offsX = reinterpret_cast<uint8_t*>(SEGENV.data);
+  uint8_t *offsY = reinterpret_cast<uint8_t*>(SEGENV.data + 1);
 
   // re-init if SEGMENT dimensions or offset changed
   if (SEGENV.call == 0 || SEGENV.aux0 != cols || SEGENV.aux1 != rows || SEGMENT.custom1 != *offsX || SEGMENT.custom2 != *offsY) {
@@ -7611,21 +7725,18 @@ uint16_t mode_2Doctopus() {
     SEGENV.aux1 = rows;
     *offsX = SEGMENT.custom1;
     *offsY = SEGMENT.custom2;
-    const int C_X = (cols / 2) + ((SEGMENT.custom1 - 128)*cols)/255;
-    const int C_Y = (rows / 2) + ((SEGMENT.custom2 - 128)*rows)/255;
-    for (int x = 0; x < cols; x++) {
-      for (int y = 0; y < rows; y++) {
-        rMap[XY(x, y)].angle  = 40.7436f * atan2f((y - C_Y), (x - C_X));  // avoid 128*atan2()/PI
-        rMap[XY(x, y)].radius = hypotf((x - C_X), (y - C_Y)) * mapp;      //thanks Sutaburosu
-      }
-    }
   }
 
+  const int C_X = (cols / 2) + ((SEGMENT.custom1 - 128)*cols)/255;
+  const int C_Y = (rows / 2) + ((SEGMENT.custom2 - 128)*rows)/255;
+  const Segment::polar_t *rMap = SEGMENT.getPolarMap(C_X, C_Y);
+  if (!rMap) return mode_static(); //allocation failed
+
   SEGENV.step += SEGMENT.speed / 32 + 1;  // 1-4 range
-  for (int x = 0; x < cols; x++) {
-    for (int y = 0; y < rows; y++) {
-      byte angle = rMap[XY(x,y)].angle;
-      byte radius = rMap[XY(x,y)].radius;
+  for (int y = 0; y < rows; y++) {
+    for (int x = 0; x < cols; x++, rMap++) {
+      byte angle = rMap->angle;
+      byte radius = rMap->radius;
       //CRGB c = CHSV(SEGENV.step / 2 - radius, 255, sin8(sin8((angle * 4 - radius) / 4 + SEGENV.step) + radius - SEGENV.step * 2 + angle * (SEGMENT.custom3/3+1)));
       uint16_t intensity = sin8(sin8((angle * 4 - radius) / 4 + SEGENV.step/2) + radius - SEGENV.step + angle * (SEGMENT.custom3/4+1));
       intensity = map(intensity*intensity, 0, 65535, 0, 255); // add a bit of non-linearity for cleaner display
@@ -7678,20 +7789,27 @@ void WS2812FX::addEffect(uint8_t id, mode_ptr mode_fn, const char *mode_name) {
     _mode[id]     = mode_fn;
     _modeData[id] = mode_name;
   } else {
+    id = _mode.size();
     _mode.push_back(mode_fn);
     _modeData.push_back(mode_name);
+    _modeMeta.push_back(mode_meta_t());
     if (_modeCount < _mode.size()) _modeCount++;
   }
+  parseModeMeta(id);
 }
 
 void WS2812FX::setupEffectData() {
   // Solid must be first! (assuming vector is empty upon call to setup)
   _mode.push_back(&mode_static);
   _modeData.push_back(_data_FX_MODE_STATIC);
+  _modeMeta.push_back(mode_meta_t());
+  parseModeMeta(0);
   // fill reserved word in case there will be any gaps in the array
   for (size_t i=1; i<_modeCount; i++) {
     _mode.push_back(&mode_static);
     _modeData.push_back(_data_RESERVED);
+    _modeMeta.push_back(mode_meta_t());
+    parseModeMeta(i);
   }
   // now replace all pre-allocated effects
   // --- 1D non-audio effects ---
@@ -30,6 +30,9 @@
 #include <vector>
 
 #include "const.h"
+#ifdef WLED_ENABLE_RENDER_TASK
+  #include "frame_queue.h"
+#endif
 
 #define FASTLED_INTERNAL //remove annoying pragma messages
 #define USE_GET_MILLISECOND_TIMER
@@ -85,6 +88,13 @@
 
 #define MIN_SHOW_DELAY   (_frametime < 16 ? 8 : 15)
 
+// adaptive segment scheduling (see WS2812FX::service())
+#define SCHED_LOAD_HIGH    90  // % of frame time spent in effects at which heaviest segment is throttled
+#define SCHED_LOAD_LOW     60  // % of frame time spent in effects below which throttling is relaxed
+#define SCHED_MAX_THROTTLE 3   // heavy segment runs at most at 1/(1+SCHED_MAX_THROTTLE) of its requested FPS
+#define SCHED_MAX_DEFER    2   // max consecutive frames a heavy segment can be postponed (staggered)
+#define SCHED_RELAX_FRAMES 50  // frames of low load before throttling of one segment is reduced
+
 #define NUM_COLORS       3 /* number of colors per segment */
 #define SEGMENT          strip._segments[strip.getCurrSegmentId()]
 #define SEGENV           strip._segments[strip.getCurrSegmentId()]
@@ -123,6 +133,12 @@
 #define REVERSE      (uint16_t)0x0002
 #define SELECTED     (uint16_t)0x0001
 
+// segment pixel writers (selected for each effect call, see Segment::selectPixelWriter())
+#define PW_GENERIC     0 // any configuration
+#define PW_1D          1 // 1D, no grouping/spacing/mirror, full brightness, no transition
+#define PW_1D_REVERSE  2 // as PW_1D but reversed
+#define PW_2D          3 // 2D, no grouping/spacing/mirror/transpose, full brightness, no transition (reverse allowed)
+
 #define FX_MODE_STATIC                   0
 #define FX_MODE_BLINK                    1
 #define FX_MODE_BREATH                   2
@@ -324,6 +340,109 @@ typedef enum mapping1D2D {
   M12_pCorner = 3
 } mapping1D2D_t;
 
+// segment parameters that can have a default in the last section of effect data (e.g. "sx=16,ix=240")
+// order must match FX_DEFAULT_KEYS in FX_fcn.cpp
+typedef enum modeDefaultKey {
+  FX_DEF_SX = 0, FX_DEF_IX, FX_DEF_C1, FX_DEF_C2, FX_DEF_C3, FX_DEF_O1, FX_DEF_O2, FX_DEF_O3,
+  FX_DEF_M12, FX_DEF_SI, FX_DEF_REV, FX_DEF_MI, FX_DEF_RY, FX_DEF_MY, FX_DEF_PAL,
+  FX_DEF_COUNT
+} mode_default_key_t;
+
+// effect metadata flags
+#define FX_META_DATA     0x01 // effect has slider/option data (@...)
+#define FX_META_1D       0x02
+#define FX_META_2D       0x04
+#define FX_META_VOLUME   0x08 // audio reactive (volume)
+#define FX_META_FREQ     0x10 // audio reactive (frequency)
+#define FX_META_RESERVED 0x80 // empty (RSVD) slot
+
+// effect metadata, parsed once from effect data string when effect is added (8 bytes per effect)
+// offsets are relative to start of effect data string in PROGMEM (0 if section is missing)
+typedef struct ModeMeta {
+  uint8_t  nameLen;     // length of effect name (i.e. offset of '@')
+  uint8_t  sliderEnd;   // offset of ';' terminating slider names
+  uint8_t  paletteOfs;  // offset of palette section
+  uint8_t  flags;       // FX_META_*
+  uint16_t defMask;     // defaults present in effect data (bit = mode_default_key_t)
+  uint16_t defIndex;    // index of first default value in WS2812FX::_modeDefaults
+} mode_meta_t;
+
+#ifndef WLED_DISABLE_FRAME_PACER
+// frame timing statistics (see WS2812FX::service()), bins halve when one of them saturates
+#define FRAME_HIST_BINS    16
+#define FRAME_JITTER_STEP  250  // us per frame interval bin, bins are centered on target frame period
+
+typedef struct FrameHistogram {
+  uint16_t bins[FRAME_HIST_BINS];
+  uint32_t minVal, maxVal, avg; // us (avg is a moving average)
+
+  void reset() { memset(bins, 0, sizeof(bins)); minVal = UINT32_MAX; maxVal = avg = 0; }
+  void add(uint8_t bin, uint32_t val) {
+    if (bins[bin] == UINT16_MAX) for (size_t i = 0; i < FRAME_HIST_BINS; i++) bins[i] >>= 1;
+    bins[bin]++;
+    val = MIN(val, 1000000UL);
+    if (val < minVal) minVal = val;
+    if (val > maxVal) maxVal = val;
+    avg = avg ? (avg * 15 + val) >> 4 : val;
+  }
+  // bin 0: <64us, bin 1: <128us, ... (durations)
+  static uint8_t log2Bin(uint32_t us) {
+    uint8_t b = 0;
+    for (us >>= 6; us && b < FRAME_HIST_BINS-1; us >>= 1) b++;
+    return b;
+  }
+  // deviation from target period in FRAME_JITTER_STEP bins, outer bins include everything beyond (intervals)
+  static uint8_t jitterBin(uint32_t us, uint32_t period) {
+    int32_t d = (int32_t)us - (int32_t)period + FRAME_HIST_BINS/2 * FRAME_JITTER_STEP;
+    return d < 0 ? 0 : MIN(d / FRAME_JITTER_STEP, FRAME_HIST_BINS-1);
+  }
+} frame_hist_t;
+#endif
+
+// Effect data arena: segment data is allocated from a single pre-allocated buffer (MAX_SEGMENT_DATA bytes)
+// instead of the heap so that cycling effects does not fragment the heap. Each block has a 4 byte header.
+// When free space gets fragmented blocks are moved (between frames) and their owners' pointers updated.
+// Note: while any effect holds data the whole buffer is reserved (more RAM than per-effect heap allocations);
+// it is freed again when all blocks are released.
+class SegmentArena {
+  public:
+    typedef bool (*relocate_cb)(byte *oldPtr, byte *newPtr); // updates owner of a block, false if owner is unknown
+
+    SegmentArena(size_t size) : _buf(nullptr), _size(size & ~3U), _used(0), _peak(0), _compactions(0), _fallbacks(0), _dirty(false) {}
+
+    void  *allocate(size_t len);
+    bool   release(void *ptr);        // returns false if ptr does not belong to arena
+    void   compact(relocate_cb relocate);
+    void   trim(void);                // frees buffer if no block is in use
+    size_t getLargestFree(void) const;
+    uint8_t getFragmentation(void) const; // % of free space not in largest free block
+
+    inline bool     owns(const void *ptr) const { return _buf && (const byte*)ptr >= _buf && (const byte*)ptr < _buf + _size; }
+    inline bool     isDirty(void)         const { return _dirty; }   // blocks were released since last compaction
+    inline size_t   getSize(void)         const { return _size; }
+    inline size_t   getUsed(void)         const { return _used; }    // including headers
+    inline size_t   getPeak(void)         const { return _peak; }
+    inline uint16_t getCompactions(void)  const { return _compactions; }
+    inline uint16_t getFallbacks(void)    const { return _fallbacks; } // allocations that had to use heap
+    inline void     addFallback(void)           { _fallbacks++; }
+
+  private:
+    typedef struct BlockHeader {
+      uint16_t size;  // payload size (multiple of 4)
+      uint16_t used;
+    } hdr_t;
+
+    byte    *_buf;
+    size_t   _size;
+    size_t   _used;
+    size_t   _peak;
+    uint16_t _compactions;
+    uint16_t _fallbacks;
+    bool     _dirty;
+
+    inline hdr_t *block(size_t offset) const { return reinterpret_cast<hdr_t*>(_buf + offset); }
+};
+
 // segment, 80 bytes
 typedef struct Segment {
   public:
@@ -375,6 +494,14 @@ typedef struct Segment {
     byte     *data; // effect data pointer
     static uint16_t maxWidth, maxHeight;  // these define matrix width & height (max. segment dimensions)
 
+  #ifndef WLED_DISABLE_2D
+    // polar coordinates of a pixel relative to a center (see getPolarMap())
+    typedef struct PolarCoordinates {
+      uint8_t angle;  // 0-255 maps to -PI..PI
+      uint8_t radius; // distance from center scaled to 180/max(width,height)
+    } polar_t;
+  #endif
+
     typedef struct TemporarySegmentData {
       uint16_t _optionsT;
       uint32_t _colorT[NUM_COLORS];
@@ -411,6 +538,13 @@ typedef struct Segment {
       };
     };
     uint16_t        _dataLen;
+    static SegmentArena _arena;
+    static void     freeData(byte *ptr);                    // release effect data block (arena or heap)
+    static bool     relocateData(byte *oldPtr, byte *newPtr); // arena compaction callback
+    uint16_t        _renderCost;  // average effect execution time in us (scheduler)
+    uint8_t         _throttle;    // frame delay multiplier added by scheduler (0 = none)
+    uint8_t         _deferred;    // consecutive frames postponed by scheduler
+    uint8_t         _pixelWriter; // PW_* fast path used by setPixelColor()/setPixelColorXY() (valid during effect call)
     static uint16_t _usedSegmentData;
 
     // perhaps this should be per segment, not static
@@ -477,6 +611,10 @@ typedef struct Segment {
       data(nullptr),
       _capabilities(0),
       _dataLen(0),
+      _renderCost(0),
+      _throttle(0),
+      _deferred(0),
+      _pixelWriter(PW_GENERIC),
       _t(nullptr)
     {
       #ifdef WLED_DEBUG
@@ -524,8 +662,12 @@ typedef struct Segment {
     inline uint16_t length(void)         const { return width() * height(); }               // segment length (count) in physical pixels
     inline uint16_t groupLength(void)    const { return grouping + spacing; }
     inline uint8_t  getLightCapabilities(void) const { return _capabilities; }
+    inline uint16_t getRenderCost(void)  const { return _renderCost; } // average effect execution time in us
+    inline uint8_t  getThrottle(void)    const { return _throttle; }
 
     static uint16_t getUsedSegmentData(void)    { return _usedSegmentData; }
+    static const SegmentArena &getDataArena(void) { return _arena; }
+    static void     compactData(void);          // compact effect data arena (only between frames)
     static void     addUsedSegmentData(int len) { _usedSegmentData += len; }
     #ifndef WLED_DISABLE_MODE_BLEND
     static void     modeBlend(bool blend)       { _modeBlend = blend; }
@@ -566,6 +708,8 @@ typedef struct Segment {
     #endif
     uint16_t progress(void); //transition progression between 0-65535
     uint8_t  currentBri(bool useCct = false);
+    void     selectPixelWriter(void);
+    inline void resetPixelWriter(void) { _pixelWriter = PW_GENERIC; }
     uint8_t  currentMode(void);
     uint32_t currentColor(uint8_t slot);
     CRGBPalette16 &loadPalette(CRGBPalette16 &tgt, uint8_t pal);
@@ -629,11 +773,16 @@ typedef struct Segment {
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, uint32_t color, uint32_t col2 = 0, int8_t rotate = 0);
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, CRGB c) { drawCharacter(chr, x, y, w, h, RGBW32(c.r,c.g,c.b,0)); } // automatic inline
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, CRGB c, CRGB c2, int8_t rotate = 0) { drawCharacter(chr, x, y, w, h, RGBW32(c.r,c.g,c.b,0), RGBW32(c2.r,c2.g,c2.b,0), rotate); } // automatic inline
+    static size_t getTextMaskSize(uint16_t mw, uint16_t mh) { return ((mw+1)/2) * mh; } // 4 bits per pixel
+    static bool renderTextMask(const char *text, uint8_t w, uint8_t h, int8_t rotate, uint8_t cellW, uint8_t *mask, uint16_t mw, uint16_t mh); // pre-render text for drawTextMask()
+    void drawTextMask(const uint8_t *mask, uint16_t mw, uint16_t mh, int16_t x, int16_t y, uint8_t h, uint32_t color, uint32_t col2 = 0);
     void wu_pixel(uint32_t x, uint32_t y, CRGB c);
     void blur1d(fract8 blur_amount); // blur all rows in 1 dimension
     void blur2d(fract8 blur_amount) { blur(blur_amount); }
     void fill_solid(CRGB c) { fill(RGBW32(c.r,c.g,c.b,0)); }
     void nscale8(uint8_t scale);
+    const polar_t *getPolarMap(int cx, int cy); // shared angle/radius table for virtual segment dimensions (valid during current effect call)
+    static void purgePolarMaps(bool all = false);
   #else
     uint16_t XY(uint16_t x, uint16_t y)                                    { return x; }
     void setPixelColorXY(int x, int y, uint32_t c)                         { setPixelColor(x, c); }
@@ -661,6 +810,9 @@ typedef struct Segment {
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, uint32_t color, uint32_t = 0, int8_t = 0) {}
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, CRGB color) {}
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, CRGB c, CRGB c2, int8_t rotate = 0) {}
+    static size_t getTextMaskSize(uint16_t mw, uint16_t mh) { return 0; }
+    static bool renderTextMask(const char *text, uint8_t w, uint8_t h, int8_t rotate, uint8_t cellW, uint8_t *mask, uint16_t mw, uint16_t mh) { return false; }
+    void drawTextMask(const uint8_t *mask, uint16_t mw, uint16_t mh, int16_t x, int16_t y, uint8_t h, uint32_t color, uint32_t col2 = 0) {}
     void wu_pixel(uint32_t x, uint32_t y, CRGB c) {}
   #endif
 } segment;
@@ -712,6 +864,37 @@ class WS2812FX {  // 96 bytes
       _callback(nullptr),
       customMappingTable(nullptr),
       customMappingSize(0),
+      _mapLoadTime(0),
+      _mapPeakMem(0),
+      _frameCost(0),
+      _schedRelax(0),
+#ifdef WLED_ENABLE_FX_REPLAY
+      _fixedClock(false),
+      _fixedTime(0),
+#endif
+#ifndef WLED_DISABLE_FRAME_PACER
+      _framePeriod(1000000UL / WLED_FPS),
+      _nextFrame(0),
+      _nextDue(0),
+      _frameStart(0),
+      _lastShowUs(0),
+      _missedFrames(0),
+#endif
+#ifdef WLED_PIXEL_CANVAS
+      _pixels(nullptr),
+#endif
+#ifdef WLED_ENABLE_DOUBLE_BUFFER
+      _framePending(false),
+#endif
+#ifdef WLED_ENABLE_RENDER_TASK
+      _renderTask(nullptr),
+      _outputTask(nullptr),
+      _renderMutex(nullptr),
+      _outputMutex(nullptr),
+      _renderTime(0),
+      _outputTime(0),
+      _droppedFrames(0),
+#endif
       _lastShow(0),
       _segment_index(0),
       _mainSegment(0),
@@ -727,14 +910,20 @@ class WS2812FX {  // 96 bytes
       WS2812FX::instance = this;
       _mode.reserve(_modeCount);     // allocate memory to prevent initial fragmentation (does not increase size())
       _modeData.reserve(_modeCount); // allocate memory to prevent initial fragmentation (does not increase size())
-      if (_mode.capacity() <= 1 || _modeData.capacity() <= 1) _modeCount = 1; // memory allocation failed only show Solid
+      _modeMeta.reserve(_modeCount);
+      if (_mode.capacity() <= 1 || _modeData.capacity() <= 1 || _modeMeta.capacity() <= 1) _modeCount = 1; // memory allocation failed only show Solid
       else setupEffectData();
+#ifndef WLED_DISABLE_FRAME_PACER
+      resetFrameStats();
+#endif
     }
 
     ~WS2812FX() {
       if (customMappingTable) delete[] customMappingTable;
       _mode.clear();
       _modeData.clear();
+      _modeMeta.clear();
+      _modeDefaults.clear();
       _segments.clear();
 #ifndef WLED_DISABLE_2D
       panel.clear();
@@ -771,6 +960,9 @@ class WS2812FX {  // 96 bytes
     void fill(uint32_t c) { for (int i = 0; i < getLengthTotal(); i++) setPixelColor(i, c); } // fill whole strip with color (inline)
     void addEffect(uint8_t id, mode_ptr mode_fn, const char *mode_name); // add effect to the list; defined in FX.cpp
     void setupEffectData(void); // add default effects to the list; defined in FX.cpp
+#ifdef WLED_ENABLE_FX_REPLAY
+    void setFixedClock(bool enable, unsigned long time = 0); // service() renders one frame at given time per call (see fx_replay.cpp)
+#endif
 
     // outsmart the compiler :) by correctly overloading
     inline void setPixelColor(int n, uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0) { setPixelColor(n, RGBW32(r,g,b,w)); }
@@ -823,6 +1015,8 @@ class WS2812FX {  // 96 bytes
     inline uint16_t getMinShowDelay(void) { return MIN_SHOW_DELAY; }
     inline uint16_t getLength(void) { return _length; } // 2D matrix may have less pixels than W*H
     inline uint16_t getTransition(void) { return _transitionDur; }
+    inline uint16_t getMapSize(void) { return customMappingSize; }
+    inline uint16_t getMapLoadTime(void) { return _mapLoadTime; } // time in ms it took to load last ledmap
 
     uint32_t
       now,
@@ -830,6 +1024,41 @@ class WS2812FX {  // 96 bytes
       getPixelColor(uint16_t);
 
     inline uint32_t getLastShow(void) { return _lastShow; }
+    inline uint32_t getMapPeakMem(void) { return _mapPeakMem; } // memory used while loading last ledmap
+    inline uint32_t getFrameCost(void) { return _frameCost; }   // time in us spent in effects during last frame
+#ifndef WLED_DISABLE_FRAME_PACER
+    inline uint32_t getFramePeriod(void)  { return _framePeriod; }  // target frame period (us)
+    inline uint32_t getMissedFrames(void) { return _missedFrames; } // frames that were over a period late (cadence restarted)
+    inline const frame_hist_t& getIntervalStats(void) { return _histInterval; }
+    inline const frame_hist_t& getRenderStats(void)   { return _histRender; }
+    inline const frame_hist_t& getShowStats(void)     { return _histShow; }
+    void resetFrameStats(void);
+#endif
+#ifdef WLED_ENABLE_RENDER_TASK
+    // render/output pipeline (effects rendered in own task, frames handed to output task through FrameQueue)
+    bool startPipeline(void);
+    void stopPipeline(void);
+    inline bool     isPipelined(void)      const { return _pixels != nullptr; }
+    inline uint32_t getRenderTime(void)    const { return _renderTime; }    // us spent rendering last frame
+    inline uint32_t getOutputTime(void)    const { return _outputTime; }    // us spent sending last frame to busses
+    inline uint32_t getDroppedFrames(void) const { return _droppedFrames; } // frames dropped because output was busy
+    inline uint8_t  getQueuedFrames(void)  const { return _frameQueue.size(); }
+    // strip/segment state may only be changed while holding the render lock (render task runs service() under it)
+    // lock order: take the render lock before requesting the JSON buffer, never the other way round
+    inline void     lockRender(void)             { if (_renderMutex) xSemaphoreTakeRecursive(_renderMutex, portMAX_DELAY); }
+    inline void     unlockRender(void)           { if (_renderMutex) xSemaphoreGiveRecursive(_renderMutex); }
+#else
+    inline bool     isPipelined(void)      const { return false; }
+    inline void     lockRender(void)             {}
+    inline void     unlockRender(void)           {}
+#endif
+#ifdef WLED_ENABLE_DOUBLE_BUFFER
+    // double buffered output: effects render into back buffer while previous frame is being sent
+    bool startDoubleBuffer(void);
+    void stopDoubleBuffer(void);
+    bool presentFrame(void);  // copies pending frame to busses once they are ready, returns false if still waiting
+    inline bool isDoubleBuffered(void) const { return _pixels != nullptr; }
+#endif
     inline uint32_t segColor(uint8_t i) { return _colors_t[i]; }
 
     const char *
@@ -838,6 +1067,12 @@ class WS2812FX {  // 96 bytes
     const char **
       getModeDataSrc(void) { return &(_modeData[0]); } // vectors use arrays for underlying data
 
+    const mode_meta_t &
+      getModeMeta(uint8_t id = 0) { return _modeMeta[id<_modeMeta.size() ? id : 0]; }
+
+    int16_t getModeDefault(uint8_t id, uint8_t key); // returns -1 if effect does not define a default for key
+    static int8_t getModeDefaultKey(const char *key, size_t len); // mode_default_key_t from name (e.g. "sx")
+
     Segment&        getSegment(uint8_t id);
     inline Segment& getFirstSelectedSeg(void) { return _segments[getFirstSelectedSegId()]; }
     inline Segment& getMainSegment(void)      { return _segments[getMainSegmentId()]; }
@@ -919,11 +1154,56 @@ class WS2812FX {  // 96 bytes
     uint8_t                  _modeCount;
     std::vector<mode_ptr>    _mode;     // SRAM footprint: 4 bytes per element
     std::vector<const char*> _modeData; // mode (effect) name and its slider control data array
+    std::vector<mode_meta_t> _modeMeta; // parsed mode data (SRAM footprint: 8 bytes per element)
+    std::vector<uint8_t>     _modeDefaults; // default values of all effects (see mode_meta_t)
+
+    void parseModeMeta(uint8_t id);
 
     show_callback _callback;
 
     uint16_t* customMappingTable;
     uint16_t  customMappingSize;
+    uint16_t  _mapLoadTime;
+    uint32_t  _mapPeakMem;
+
+    uint32_t  _frameCost;   // effect execution time of last frame (us)
+    uint8_t   _schedRelax;  // frames with low load since last scheduling change
+#ifdef WLED_ENABLE_FX_REPLAY
+    bool          _fixedClock;  // replay: service() uses _fixedTime instead of millis()/micros()
+    unsigned long _fixedTime;   // ms
+#endif
+
+#ifndef WLED_DISABLE_FRAME_PACER
+    uint32_t     _framePeriod;  // us
+    unsigned long _nextFrame;   // micros() of next frame tick
+    unsigned long _nextDue;     // millis() of a segment falling due before next tick (0 = none)
+    unsigned long _frameStart;  // micros() of last rendered frame
+    unsigned long _lastShowUs;
+    uint32_t     _missedFrames;
+    frame_hist_t _histInterval; // time between rendered frames
+    frame_hist_t _histRender;   // time spent in effects
+    frame_hist_t _histShow;     // time spent in show()
+#endif
+
+#ifdef WLED_PIXEL_CANVAS
+    uint32_t         *_pixels;      // render canvas (physical pixels) while pipeline/double buffer is active
+#endif
+#ifdef WLED_ENABLE_DOUBLE_BUFFER
+    bool              _framePending; // canvas holds a frame not yet copied to busses
+#endif
+#ifdef WLED_ENABLE_RENDER_TASK
+    FrameQueue        _frameQueue;  // rendered frames waiting for output
+    TaskHandle_t      _renderTask;
+    TaskHandle_t      _outputTask;
+    SemaphoreHandle_t _renderMutex; // held by producer (service()/show()), recursive
+    SemaphoreHandle_t _outputMutex; // held by consumer while writing busses
+    uint32_t          _renderTime;
+    uint32_t          _outputTime;
+    uint32_t          _droppedFrames;
+
+    static void renderTaskFn(void *param);
+    static void outputTaskFn(void *param);
+#endif
 
     unsigned long _lastShow;
 
@@ -937,10 +1217,31 @@ class WS2812FX {  // 96 bytes
     uint8_t
       estimateCurrentAndLimitBri(void);
 
+    void     showBusses(void);
+#ifdef WLED_PIXEL_CANVAS
+    bool     allocateCanvas(void);
+    void     freeCanvas(void);
+#endif
+
+    void     adjustSchedule(void);
+
+    uint32_t getMatrixCacheKey(void);
+    bool     loadMatrixCache(uint32_t key);
+    void     saveMatrixCache(uint32_t key);
+
     void
       setUpSegmentFromQueuedChanges(void);
 };
 
+// RAII guard for the render lock (see WS2812FX::lockRender()), modeled after JSONBufferGuard
+class RenderLockGuard {
+  public:
+    inline RenderLockGuard()  { WS2812FX::getInstance()->lockRender(); }
+    inline ~RenderLockGuard() { WS2812FX::getInstance()->unlockRender(); }
+    inline RenderLockGuard(const RenderLockGuard&) = delete; // Noncopyable
+    inline RenderLockGuard& operator=(const RenderLockGuard&) = delete;
+};
+
 extern const char JSON_mode_names[];
 extern const char JSON_palette_names[];
 
@@ -26,6 +26,97 @@
 #include "FX.h"
 #include "palettes.h"
 
+// composed matrix mapping (panels, gaps and default ledmap) is cached in a binary file
+// layout (little endian): 3 bytes "WMC", 1 byte version, uint16 entry count, uint32 key, entry count * uint16
+// key is a hash of panel configuration and size & modification time of input files, so the cache is
+// rebuilt only when any of them changes (files are not read to validate the cache)
+// mtime is only a hint (LittleFS has no time before NTP sync), uploads of these files delete the cache (see handleUpload())
+#ifndef WLED_DISABLE_2D
+#define MATRIX_CACHE_VERSION  1
+#define MATRIX_CACHE_HDRSIZE  10
+
+// FNV-1a hash (incremental)
+static uint32_t hashBytes(const uint8_t *data, size_t len, uint32_t hash) {
+  for (size_t i = 0; i < len; i++) hash = (hash ^ data[i]) * 16777619U;
+  return hash;
+}
+
+static uint32_t hashFileStat(const char *fileName, uint32_t hash) {
+  File file = WLED_FS.open(fileName, "r");
+  if (!file) return hashBytes((const uint8_t*)"-", 1, hash); // distinguish missing file from empty one
+  uint32_t stat[2] = { (uint32_t)file.size(), (uint32_t)file.getLastWrite() };
+  file.close();
+  return hashBytes((const uint8_t*)stat, sizeof(stat), hash);
+}
+
+// calculates cache key from panel configuration and size/mtime of gaps file and default ledmap
+uint32_t WS2812FX::getMatrixCacheKey() {
+  uint32_t hash = 2166136261U;
+  hash = hashBytes((const uint8_t*)&Segment::maxWidth,  sizeof(Segment::maxWidth),  hash);
+  hash = hashBytes((const uint8_t*)&Segment::maxHeight, sizeof(Segment::maxHeight), hash);
+  for (const Panel &p : panel) {
+    uint8_t cfg[] = { uint8_t(p.xOffset), uint8_t(p.xOffset>>8), uint8_t(p.yOffset), uint8_t(p.yOffset>>8), p.width, p.height, p.options };
+    hash = hashBytes(cfg, sizeof(cfg), hash);
+  }
+  char fileName[16];
+  strcpy_P(fileName, PSTR("/2d-gaps.json"));
+  hash = hashFileStat(fileName, hash);
+  strcpy_P(fileName, PSTR("/ledmap.bin"));
+  if (!WLED_FS.exists(fileName)) strcpy_P(fileName, PSTR("/ledmap.json"));
+  hash = hashFileStat(fileName, hash);
+  return hash;
+}
+
+// loads composed mapping table from cache if key matches
+bool WS2812FX::loadMatrixCache(uint32_t key) {
+  char fileName[16]; strcpy_P(fileName, PSTR("/2d-cache.bin"));
+  File file = WLED_FS.open(fileName, "r");
+  if (!file) return false;
+  uint8_t hdr[MATRIX_CACHE_HDRSIZE];
+  if (file.read(hdr, MATRIX_CACHE_HDRSIZE) != MATRIX_CACHE_HDRSIZE || hdr[0] != 'W' || hdr[1] != 'M' || hdr[2] != 'C' || hdr[3] != MATRIX_CACHE_VERSION) {
+    file.close();
+    return false;
+  }
+  uint16_t count = hdr[4] | (hdr[5] << 8);
+  uint32_t fKey  = hdr[6] | (hdr[7] << 8) | (hdr[8] << 16) | ((uint32_t)hdr[9] << 24);
+  if (fKey != key || !count || file.size() != MATRIX_CACHE_HDRSIZE + count * sizeof(uint16_t)) {
+    file.close();
+    return false;
+  }
+  customMappingTable = new uint16_t[count];
+  if (customMappingTable == nullptr) {
+    file.close();
+    return false;
+  }
+  size_t len = count * sizeof(uint16_t);
+  if (file.read(reinterpret_cast<uint8_t*>(customMappingTable), len) != len) { // single read
+    delete[] customMappingTable;
+    customMappingTable = nullptr;
+    file.close();
+    return false;
+  }
+  customMappingSize = count;
+  file.close();
+  return true;
+}
+
+void WS2812FX::saveMatrixCache(uint32_t key) {
+  if (customMappingTable == nullptr || customMappingSize == 0) return;
+  char fileName[16]; strcpy_P(fileName, PSTR("/2d-cache.bin"));
+  File file = WLED_FS.open(fileName, "w");
+  if (!file) return;
+  uint8_t hdr[MATRIX_CACHE_HDRSIZE] = { 'W', 'M', 'C', MATRIX_CACHE_VERSION,
+                                        uint8_t(customMappingSize), uint8_t(customMappingSize >> 8),
+                                        uint8_t(key), uint8_t(key >> 8), uint8_t(key >> 16), uint8_t(key >> 24) };
+  size_t len = customMappingSize * sizeof(uint16_t);
+  bool ok = file.write(hdr, MATRIX_CACHE_HDRSIZE) == MATRIX_CACHE_HDRSIZE
+         && file.write(reinterpret_cast<const uint8_t*>(customMappingTable), len) == len;
+  file.close();
+  if (!ok) WLED_FS.remove(fileName); // do not leave truncated cache behind
+  DEBUG_PRINTF("Matrix cache %s (%08X).\n", ok ? "saved" : "failed", key);
+}
+#endif
+
 // setUpMatrix() - constructs ledmap array from matrix of panels with WxH pixels
 // this converts physical (possibly irregular) LED arrangement into well defined
 // array of logical pixels: fist entry corresponds to left-topmost logical pixel
@@ -34,6 +125,7 @@
 // note: matrix may be comprised of multiple panels each with different orientation
 // but ledmap takes care of that. ledmap is constructed upon initialization
 // so matrix should disable regular ledmap processing
+// default ledmap (if present) is applied on top and the result is cached (see loadMatrixCache())
 void WS2812FX::setUpMatrix() {
 #ifndef WLED_DISABLE_2D
   // erase old ledmap, just in case.
@@ -68,6 +160,15 @@ void WS2812FX::setUpMatrix() {
       return;
     }
 
+    unsigned long start = millis();
+    uint32_t cacheKey = getMatrixCacheKey();
+    if (loadMatrixCache(cacheKey)) {
+      _mapLoadTime = millis() - start;
+      _mapPeakMem  = customMappingSize * sizeof(uint16_t);
+      DEBUG_PRINTF("Matrix ledmap loaded from cache in %u ms.\n", (unsigned)_mapLoadTime);
+      return;
+    }
+
     customMappingTable = new uint16_t[Segment::maxWidth * Segment::maxHeight];
 
     if (customMappingTable != nullptr) {
@@ -140,6 +241,10 @@ void WS2812FX::setUpMatrix() {
       }
       DEBUG_PRINTLN();
       #endif
+
+      deserializeMap(); // default ledmap (if exists) overrides matrix mapping
+      saveMatrixCache(cacheKey);
+      _mapLoadTime = millis() - start;
     } else { // memory allocation error
       DEBUG_PRINTLN(F("Ledmap alloc error."));
       isMatrix = false;
@@ -172,6 +277,15 @@ uint16_t IRAM_ATTR Segment::XY(uint16_t x, uint16_t y)
 
 void IRAM_ATTR Segment::setPixelColorXY(int x, int y, uint32_t col)
 {
+  if (_pixelWriter == PW_2D) {
+    // fast path: virtual pixel maps directly onto physical pixel
+    const int w = width(), h = height();
+    if (unsigned(x) >= unsigned(w) || unsigned(y) >= unsigned(h)) return;
+    if (reverse  ) x = w - x - 1;
+    if (reverse_y) y = h - y - 1;
+    strip.setPixelColorXY(start + x, startY + y, col);
+    return;
+  }
   if (!isActive()) return; // not active
   if (x >= virtualWidth() || y >= virtualHeight() || x<0 || y<0) return;  // if pixel would fall out of virtual segment just exit
 
@@ -229,38 +343,42 @@ void Segment::setPixelColorXY(float x, float y, uint32_t col, bool aa)
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
 
-  float fX = x * (cols-1);
-  float fY = y * (rows-1);
+  // position in Q16.16 fixed point
+  uint32_t fX = uint32_t(x * 65536.0f) * (cols-1);
+  uint32_t fY = uint32_t(y * 65536.0f) * (rows-1);
   if (aa) {
-    uint16_t xL = roundf(fX-0.49f);
-    uint16_t xR = roundf(fX+0.49f);
-    uint16_t yT = roundf(fY-0.49f);
-    uint16_t yB = roundf(fY+0.49f);
-    float    dL = (fX - xL)*(fX - xL);
-    float    dR = (xR - fX)*(xR - fX);
-    float    dT = (fY - yT)*(fY - yT);
-    float    dB = (yB - fY)*(yB - fY);
+    uint32_t fracX = fX & 0xFFFF;
+    uint32_t fracY = fY & 0xFFFF;
+    uint16_t xL = (fX >> 16) + (fracX > 0xFD70); // round to pixel if within 1%
+    uint16_t xR = (fX >> 16) + (fracX > 0x028F);
+    uint16_t yT = (fY >> 16) + (fracY > 0xFD70);
+    uint16_t yB = (fY >> 16) + (fracY > 0x028F);
+    // distances from pixels in Q8 (sqrt(dL*dT) == distX*distY so no square root is needed)
+    uint32_t dL = fracX >> 8;
+    uint32_t dR = (0x10000 - fracX) >> 8;
+    uint32_t dT = fracY >> 8;
+    uint32_t dB = (0x10000 - fracY) >> 8;
     uint32_t cXLYT = getPixelColorXY(xL, yT);
     uint32_t cXRYT = getPixelColorXY(xR, yT);
     uint32_t cXLYB = getPixelColorXY(xL, yB);
     uint32_t cXRYB = getPixelColorXY(xR, yB);
 
     if (xL!=xR && yT!=yB) {
-      setPixelColorXY(xL, yT, color_blend(col, cXLYT, uint8_t(sqrtf(dL*dT)*255.0f))); // blend TL pixel
-      setPixelColorXY(xR, yT, color_blend(col, cXRYT, uint8_t(sqrtf(dR*dT)*255.0f))); // blend TR pixel
-      setPixelColorXY(xL, yB, color_blend(col, cXLYB, uint8_t(sqrtf(dL*dB)*255.0f))); // blend BL pixel
-      setPixelColorXY(xR, yB, color_blend(col, cXRYB, uint8_t(sqrtf(dR*dB)*255.0f))); // blend BR pixel
+      setPixelColorXY(xL, yT, color_blend(col, cXLYT, MIN(dL*dT >> 8, 255))); // blend TL pixel
+      setPixelColorXY(xR, yT, color_blend(col, cXRYT, MIN(dR*dT >> 8, 255))); // blend TR pixel
+      setPixelColorXY(xL, yB, color_blend(col, cXLYB, MIN(dL*dB >> 8, 255))); // blend BL pixel
+      setPixelColorXY(xR, yB, color_blend(col, cXRYB, MIN(dR*dB >> 8, 255))); // blend BR pixel
     } else if (xR!=xL && yT==yB) {
-      setPixelColorXY(xR, yT, color_blend(col, cXLYT, uint8_t(dL*255.0f))); // blend L pixel
-      setPixelColorXY(xR, yT, color_blend(col, cXRYT, uint8_t(dR*255.0f))); // blend R pixel
+      setPixelColorXY(xL, yT, color_blend(col, cXLYT, MIN(dL*dL >> 8, 255))); // blend L pixel
+      setPixelColorXY(xR, yT, color_blend(col, cXRYT, MIN(dR*dR >> 8, 255))); // blend R pixel
     } else if (xR==xL && yT!=yB) {
-      setPixelColorXY(xR, yT, color_blend(col, cXLYT, uint8_t(dT*255.0f))); // blend T pixel
-      setPixelColorXY(xL, yB, color_blend(col, cXLYB, uint8_t(dB*255.0f))); // blend B pixel
+      setPixelColorXY(xR, yT, color_blend(col, cXLYT, MIN(dT*dT >> 8, 255))); // blend T pixel
+      setPixelColorXY(xL, yB, color_blend(col, cXLYB, MIN(dB*dB >> 8, 255))); // blend B pixel
     } else {
       setPixelColorXY(xL, yT, col); // exact match (x & y land on a pixel)
     }
   } else {
-    setPixelColorXY(uint16_t(roundf(fX)), uint16_t(roundf(fY)), col);
+    setPixelColorXY(uint16_t((fX + 0x8000) >> 16), uint16_t((fY + 0x8000) >> 16), col);
   }
 }
 
@@ -530,46 +648,114 @@ void Segment::drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint3
 #include "src/font/console_font_6x8.h"
 #include "src/font/console_font_7x9.h"
 
-// draws a raster font character on canvas
+// returns bitmap of a raster font (one byte per glyph row, MSB first) or nullptr if not supported
 // only supports: 4x6=24, 5x8=40, 5x12=60, 6x8=48 and 7x9=63 fonts ATM
+static const unsigned char *getFontBitmap(uint8_t w, uint8_t h) {
+  switch (w*h) {
+    case 24: return console_font_4x6;  // 4x6 font
+    case 40: return console_font_5x8;  // 5x8 font
+    case 48: return console_font_6x8;  // 6x8 font
+    case 63: return console_font_7x9;  // 7x9 font
+    case 60: return console_font_5x12; // 5x12 font
+  }
+  return nullptr;
+}
+
+// position of glyph pixel (row i, column j) within rotated character cell
+static inline void rotateGlyphPixel(int i, int j, uint8_t w, uint8_t h, int8_t rotate, int &dx, int &dy) {
+  switch (rotate) {
+    case -1: dx = (h-1) - i; dy = (w-1) - j; break; // -90 deg
+    case -2:
+    case  2: dx = j;         dy = (h-1) - i; break; // 180 deg
+    case  1: dx = i;         dy = j;         break; // +90 deg
+    default: dx = (w-1) - j; dy = i;         break; // no rotation
+  }
+}
+
+// draws a raster font character on canvas
 void Segment::drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, uint32_t color, uint32_t col2, int8_t rotate) {
   if (!isActive()) return; // not active
   if (chr < 32 || chr > 126) return; // only ASCII 32-126 supported
   chr -= 32; // align with font table entries
+  const unsigned char *font = getFontBitmap(w, h);
+  if (!font) return;
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
-  const int font = w*h;
 
   CRGB col = CRGB(color);
   CRGBPalette16 grad = CRGBPalette16(col, col2 ? CRGB(col2) : col);
 
-  //if (w<5 || w>6 || h!=8) return;
   for (int i = 0; i<h; i++) { // character height
-    uint8_t bits = 0;
-    switch (font) {
-      case 24: bits = pgm_read_byte_near(&console_font_4x6[(chr * h) + i]); break;  // 5x8 font
-      case 40: bits = pgm_read_byte_near(&console_font_5x8[(chr * h) + i]); break;  // 5x8 font
-      case 48: bits = pgm_read_byte_near(&console_font_6x8[(chr * h) + i]); break;  // 6x8 font
-      case 63: bits = pgm_read_byte_near(&console_font_7x9[(chr * h) + i]); break;  // 7x9 font
-      case 60: bits = pgm_read_byte_near(&console_font_5x12[(chr * h) + i]); break; // 5x12 font
-      default: return;
-    }
+    uint8_t bits = pgm_read_byte_near(&font[(chr * h) + i]);
+    if (!bits) continue; // empty glyph row
     col = ColorFromPalette(grad, (i+1)*255/h, 255, NOBLEND);
     for (int j = 0; j<w; j++) { // character width
+      if (!((bits>>(j+(8-w))) & 0x01)) continue; // bit not set
       int x0, y0;
-      switch (rotate) {
-        case -1: x0 = x + (h-1) - i; y0 = y + (w-1) - j; break; // -90 deg
-        case -2:
-        case  2: x0 = x + j;         y0 = y + (h-1) - i; break; // 180 deg
-        case  1: x0 = x + i;         y0 = y + j;         break; // +90 deg
-        default: x0 = x + (w-1) - j; y0 = y + i;         break; // no rotation
-      }
+      rotateGlyphPixel(i, j, w, h, rotate, x0, y0);
+      x0 += x; y0 += y;
       if (x0 < 0 || x0 >= cols || y0 < 0 || y0 >= rows) continue; // drawing off-screen
-      if (((bits>>(j+(8-w))) & 0x01)) { // bit set
-        setPixelColorXY(x0, y0, col);
+      setPixelColorXY(x0, y0, col);
+    }
+  }
+}
+
+// renders text into a 4 bit mask with one nibble per pixel (glyph row + 1, 0 = transparent), row stride is (mw+1)/2
+// characters are placed every cellW pixels; mask must be at least getTextMaskSize() bytes (see mode_2Dscrollingtext())
+// returns false if font is not supported
+bool Segment::renderTextMask(const char *text, uint8_t w, uint8_t h, int8_t rotate, uint8_t cellW, uint8_t *mask, uint16_t mw, uint16_t mh) {
+  const unsigned char *font = getFontBitmap(w, h);
+  if (!font || !mask) return false;
+  const size_t stride = (mw+1)/2;
+  memset(mask, 0, stride*mh);
+  for (size_t c = 0; text[c]; c++) {
+    unsigned char chr = text[c];
+    if (chr < 32 || chr > 126) continue; // only ASCII 32-126 supported
+    chr -= 32;
+    for (int i = 0; i<h; i++) {
+      uint8_t bits = pgm_read_byte_near(&font[(chr * h) + i]);
+      for (int j = 0; bits && j<w; j++) {
+        if (!((bits>>(j+(8-w))) & 0x01)) continue;
+        int mx, my;
+        rotateGlyphPixel(i, j, w, h, rotate, mx, my);
+        mx += c*cellW;
+        if (mx >= mw || my >= mh) continue;
+        uint8_t &m = mask[my*stride + (mx>>1)];
+        const uint8_t shift = (mx&1)<<2;
+        m = (m & ~(0x0F << shift)) | ((i+1) << shift); // later characters overwrite overlapping pixels
       }
     }
   }
+  return true;
+}
+
+// blits text mask (see renderTextMask()) at position x,y clipping it to the segment
+// only visible spans of mask are visited; glyph row colors are computed once per call (h = font height)
+void Segment::drawTextMask(const uint8_t *mask, uint16_t mw, uint16_t mh, int16_t x, int16_t y, uint8_t h, uint32_t color, uint32_t col2) {
+  if (!isActive() || !mask || h == 0 || h > 15) return;
+  const int cols = virtualWidth();
+  const int rows = virtualHeight();
+  const int xStart = MAX(0, (int)x), xEnd = MIN(cols, x + (int)mw);
+  const int yStart = MAX(0, (int)y), yEnd = MIN(rows, y + (int)mh);
+  if (xStart >= xEnd || yStart >= yEnd) return; // nothing visible
+
+  CRGB col = CRGB(color);
+  CRGBPalette16 grad = CRGBPalette16(col, col2 ? CRGB(col2) : col);
+  uint32_t rowColor[15];
+  for (int i = 0; i<h; i++) {
+    col = ColorFromPalette(grad, (i+1)*255/h, 255, NOBLEND);
+    rowColor[i] = RGBW32(col.r, col.g, col.b, 0);
+  }
+
+  const size_t stride = (mw+1)/2;
+  for (int py = yStart; py < yEnd; py++) {
+    const uint8_t *row = mask + (py - y)*stride;
+    for (int px = xStart; px < xEnd; px++) {
+      int mx = px - x;
+      uint8_t v = (row[mx>>1] >> ((mx&1)<<2)) & 0x0F;
+      if (v) setPixelColorXY(px, py, rowColor[v-1]);
+    }
+  }
 }
 
 #define WU_WEIGHT(a,b) ((uint8_t) (((a)*(b)+(a)+(b))>>8))
@@ -591,4 +777,74 @@ void Segment::wu_pixel(uint32_t x, uint32_t y, CRGB c) {      //awesome wu_pixel
 }
 #undef WU_WEIGHT
 
+// polar map cache is shared by all segments; entries are keyed by virtual dimensions and center
+// so that segments (or effects) with identical geometry share the same table and any resize
+// or center change implicitly produces a new entry; least recently used entry is evicted
+#ifdef ESP8266
+#define POLAR_MAP_CACHE_SIZE 2
+#else
+#define POLAR_MAP_CACHE_SIZE 4
+#endif
+#define POLAR_MAP_TIMEOUT    10000 // free maps not used for 10s
+
+static struct PolarMapCache {
+  uint16_t          width;
+  uint16_t          height;
+  int16_t           cx;
+  int16_t           cy;
+  unsigned long     lastUsed;
+  Segment::polar_t *map;
+} polarMaps[POLAR_MAP_CACHE_SIZE] = {};
+
+// returns table of width*height entries (index: x + y*width) or nullptr if out of memory
+// pointer is only valid until the end of current effect call, do not store it
+const Segment::polar_t *Segment::getPolarMap(int cx, int cy) {
+  const uint16_t cols = virtualWidth();
+  const uint16_t rows = virtualHeight();
+  if (cols == 0 || rows == 0) return nullptr;
+
+  PolarMapCache *slot = &polarMaps[0];
+  for (int i = 0; i < POLAR_MAP_CACHE_SIZE; i++) {
+    PolarMapCache &e = polarMaps[i];
+    if (e.map && e.width == cols && e.height == rows && e.cx == cx && e.cy == cy) {
+      e.lastUsed = millis();
+      return e.map;
+    }
+    if (!e.map) slot = &e;  // prefer empty slot
+    else if (slot->map && e.lastUsed < slot->lastUsed) slot = &e;
+  }
+
+  if (slot->map) free(slot->map);
+  slot->map = (polar_t*) malloc(cols * rows * sizeof(polar_t));
+  if (!slot->map) { DEBUG_PRINTLN(F("!!! Polar map allocation failed. !!!")); return nullptr; }
+  slot->width    = cols;
+  slot->height   = rows;
+  slot->cx       = cx;
+  slot->cy       = cy;
+  slot->lastUsed = millis();
+
+  const uint8_t mapp = 180 / MAX(cols,rows);
+  polar_t *p = slot->map;
+  for (int y = 0; y < rows; y++) {
+    for (int x = 0; x < cols; x++, p++) {
+      p->angle  = 40.7436f * atan2f((y - cy), (x - cx)); // avoid 128*atan2()/PI
+      p->radius = hypotf((x - cx), (y - cy)) * mapp;
+    }
+  }
+  DEBUG_PRINTF("Polar map %dx%d @ %d,%d built.\n", cols, rows, cx, cy);
+  return slot->map;
+}
+
+// free unused (or all) polar maps
+void Segment::purgePolarMaps(bool all) {
+  const unsigned long now = millis();
+  for (int i = 0; i < POLAR_MAP_CACHE_SIZE; i++) {
+    PolarMapCache &e = polarMaps[i];
+    if (e.map && (all || now - e.lastUsed > POLAR_MAP_TIMEOUT)) {
+      free(e.map);
+      e.map = nullptr;
+    }
+  }
+}
+
 #endif // WLED_DISABLE_2D
@@ -41,6 +41,9 @@
   {"map":[
   0, 1, 2, 3, 4, 9, 8, 7, 6, 5, 10, 11, 12, 13, 14,
   19, 18, 17, 16, 15, 20, 21, 22, 23, 24, 29, 28, 27, 26, 25]}
+
+  For large installations convert it to "ledmap.bin" (node tools/ledmap2bin.js ledmap.json)
+  which is loaded directly into mapping table.
 */
 
 //factory defaults LED setup
@@ -70,10 +73,121 @@
 #endif
 
 
+///////////////////////////////////////////////////////////////////////////////
+// Segment data arena implementation
+///////////////////////////////////////////////////////////////////////////////
+void *SegmentArena::allocate(size_t len) {
+  if (len == 0 || len > 0xFFFC) return nullptr;
+  if (!_buf) {
+    // arena is allocated on first use and released by trim() when empty
+    #if defined(ARDUINO_ARCH_ESP32) && defined(BOARD_HAS_PSRAM) && defined(WLED_SEGMENT_DATA_PSRAM)
+    if (psramFound()) _buf = (byte*) ps_malloc(_size); // PSRAM is slower but saves internal RAM
+    #endif
+    if (!_buf) _buf = (byte*) malloc(_size);
+    if (!_buf) return nullptr;
+    block(0)->size = _size - sizeof(hdr_t);
+    block(0)->used = 0;
+  }
+  const size_t need = (len + 3) & ~3U;
+  // first fit
+  for (size_t off = 0; off < _size; off += sizeof(hdr_t) + block(off)->size) {
+    hdr_t *b = block(off);
+    if (b->used) continue;
+    // merge adjacent free blocks
+    size_t next = off + sizeof(hdr_t) + b->size;
+    while (next < _size && !block(next)->used) {
+      b->size += sizeof(hdr_t) + block(next)->size;
+      next = off + sizeof(hdr_t) + b->size;
+    }
+    if (b->size < need) continue;
+    if (b->size - need >= 2*sizeof(hdr_t)) {
+      // split block, remainder stays free
+      hdr_t *r = block(off + sizeof(hdr_t) + need);
+      r->size = b->size - need - sizeof(hdr_t);
+      r->used = 0;
+      b->size = need;
+    }
+    b->used = 1;
+    _used += sizeof(hdr_t) + b->size;
+    if (_used > _peak) _peak = _used;
+    return _buf + off + sizeof(hdr_t);
+  }
+  return nullptr;
+}
+
+// frees the arena buffer while no block is in use (it is allocated again on next use)
+void SegmentArena::trim() {
+  if (!_buf || _used) return;
+  free(_buf);
+  _buf = nullptr;
+  _dirty = false;
+}
+
+bool SegmentArena::release(void *ptr) {
+  if (!owns(ptr)) return false;
+  hdr_t *b = reinterpret_cast<hdr_t*>((byte*)ptr - sizeof(hdr_t));
+  if (b->used) {
+    b->used = 0;
+    _used -= sizeof(hdr_t) + b->size;
+    _dirty = true;
+  }
+  return true;
+}
+
+// move used blocks towards the start of arena so that free space becomes one block
+// blocks whose owner is unknown (relocate() fails) are left in place
+void SegmentArena::compact(relocate_cb relocate) {
+  if (!_buf) return;
+  size_t dst = 0;
+  for (size_t off = 0; off < _size; ) {
+    size_t len = sizeof(hdr_t) + block(off)->size;
+    if (block(off)->used) {
+      if (dst == off) {
+        dst += len;
+      } else if (relocate(_buf + off + sizeof(hdr_t), _buf + dst + sizeof(hdr_t))) {
+        memmove(_buf + dst, _buf + off, len);
+        dst += len;
+      } else {
+        // pinned block, space in front of it becomes a free block
+        block(dst)->size = off - dst - sizeof(hdr_t);
+        block(dst)->used = 0;
+        dst = off + len;
+      }
+    }
+    off += len;
+  }
+  if (dst < _size) {
+    block(dst)->size = _size - dst - sizeof(hdr_t);
+    block(dst)->used = 0;
+  }
+  _compactions++;
+  _dirty = false;
+  DEBUG_PRINTF("Segment data compacted: %u/%u used, largest free %u.\n", (unsigned)_used, (unsigned)_size, (unsigned)getLargestFree());
+}
+
+size_t SegmentArena::getLargestFree() const {
+  if (!_buf) return _size - sizeof(hdr_t);
+  size_t largest = 0, run = 0;
+  for (size_t off = 0; off < _size; off += sizeof(hdr_t) + block(off)->size) {
+    if (block(off)->used) { run = 0; continue; }
+    run += sizeof(hdr_t) + block(off)->size;  // adjacent free blocks will be merged
+    if (run - sizeof(hdr_t) > largest) largest = run - sizeof(hdr_t);
+  }
+  return largest;
+}
+
+uint8_t SegmentArena::getFragmentation() const {
+  size_t free = _size - _used;
+  if (!_buf || free <= sizeof(hdr_t)) return 0;
+  return 100 - (getLargestFree() + sizeof(hdr_t)) * 100 / free;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Segment class implementation
 ///////////////////////////////////////////////////////////////////////////////
 uint16_t Segment::_usedSegmentData = 0U; // amount of RAM all segments use for their data[]
+SegmentArena Segment::_arena(MAX_SEGMENT_DATA);
 uint16_t Segment::maxWidth = DEFAULT_LED_COUNT;
 uint16_t Segment::maxHeight = 1;
 
@@ -158,8 +272,18 @@ bool Segment::allocateData(size_t len) {
     DEBUG_PRINTF("%d/%d !!!\n", len, Segment::getUsedSegmentData());
     return false;
   }
-  // do not use SPI RAM on ESP32 since it is slow
-  data = (byte*) malloc(len);
+  data = (byte*) _arena.allocate(len);
+  if (!data && !_modeBlend && _arena.getSize() - _arena.getUsed() > len && strip.isServicing() && this == &strip._segments[strip.getCurrSegmentId()]) {
+    // enough space but fragmented: compact now (only while running this segment's effect so no other owner is in use)
+    // not while blending: the new mode's data is then only referenced by a swapped out (stack) copy of the segment
+    _arena.compact(relocateData);
+    data = (byte*) _arena.allocate(len);
+  }
+  if (!data) {
+    // do not use SPI RAM on ESP32 since it is slow
+    data = (byte*) malloc(len);
+    if (data) _arena.addFallback();
+  }
   if (!data) { DEBUG_PRINTLN(F("!!! Allocation failed. !!!")); return false; } //allocation failed
   Segment::addUsedSegmentData(len);
   //DEBUG_PRINTF("---  Allocated data (%p): %d/%d -> %p\n", this, len, Segment::getUsedSegmentData(), data);
@@ -172,7 +296,7 @@ void Segment::deallocateData() {
   if (!data) { _dataLen = 0; return; }
   //DEBUG_PRINTF("---  Released data (%p): %d/%d -> %p\n", this, _dataLen, Segment::getUsedSegmentData(), data);
   if ((Segment::getUsedSegmentData() > 0) && (_dataLen > 0)) { // check that we don't have a dangling / inconsistent data pointer
-    free(data);
+    freeData(data);
   } else {
     DEBUG_PRINT(F("---- Released data "));
     DEBUG_PRINTF("(%p): ", this);
@@ -192,11 +316,35 @@ void Segment::deallocateData() {
   * because it could access the data buffer and this method
   * may free that data buffer.
   */
+void Segment::freeData(byte *ptr) {
+  if (!_arena.release(ptr)) free(ptr);
+}
+
+// arena compaction callback: update every known owner of the block (segment and its transition)
+bool Segment::relocateData(byte *oldPtr, byte *newPtr) {
+  bool found = false;
+  for (segment &seg : strip._segments) {
+    if (seg.data == oldPtr) { seg.data = newPtr; found = true; }
+    #ifndef WLED_DISABLE_MODE_BLEND
+    if (seg._t && seg._t->_segT._dataT == oldPtr) { seg._t->_segT._dataT = newPtr; found = true; }
+    #endif
+  }
+  return found;
+}
+
+// compact effect data arena if it got fragmented, release it when empty (called between frames)
+void Segment::compactData() {
+  if (!_arena.isDirty()) return;
+  if (!_arena.getUsed()) _arena.trim();
+  else if (_arena.getFragmentation() >= 50) _arena.compact(relocateData);
+}
+
 void Segment::resetIfRequired() {
   if (!reset) return;
   //DEBUG_PRINTF("-- Segment reset: %p\n", this);
   deallocateData();
   next_time = 0; step = 0; call = 0; aux0 = 0; aux1 = 0;
+  _renderCost = 0; _throttle = 0; _deferred = 0; // new effect may have different cost
   reset = false;
 }
 
@@ -305,7 +453,8 @@ void Segment::startTransition(uint16_t dur) {
     _t->_segT._dataLenT = 0;
     _t->_segT._dataT    = nullptr;
     if (_dataLen > 0 && data) {
-      _t->_segT._dataT = (byte *)malloc(_dataLen);
+      _t->_segT._dataT = (byte *)_arena.allocate(_dataLen);
+      if (!_t->_segT._dataT) _t->_segT._dataT = (byte *)malloc(_dataLen);
       if (_t->_segT._dataT) {
         //DEBUG_PRINTF("--  Allocated duplicate data (%d): %p\n", _dataLen, _t->_segT._dataT);
         memcpy(_t->_segT._dataT, data, _dataLen);
@@ -326,7 +475,7 @@ void Segment::stopTransition() {
     #ifndef WLED_DISABLE_MODE_BLEND
     if (_t->_segT._dataT && _t->_segT._dataLenT > 0) {
       //DEBUG_PRINTF("--  Released duplicate data (%d): %p\n", _t->_segT._dataLenT, _t->_segT._dataT);
-      free(_t->_segT._dataT);
+      freeData(_t->_segT._dataT);
       _t->_segT._dataT = nullptr;
       _t->_segT._dataLenT = 0;
     }
@@ -564,30 +713,30 @@ void Segment::setOption(uint8_t n, bool val) {
 
 void Segment::setMode(uint8_t fx, bool loadDefaults) {
   // if we have a valid mode & is not reserved
-  if (fx < strip.getModeCount() && strncmp_P("RSVD", strip.getModeData(fx), 4)) {
+  if (fx < strip.getModeCount() && !(strip.getModeMeta(fx).flags & FX_META_RESERVED)) {
     if (fx != mode) {
 #ifndef WLED_DISABLE_MODE_BLEND
       if (modeBlending) startTransition(strip.getTransition()); // set effect transitions
 #endif
       mode = fx;
-      // load default values from effect string
+      // load default values from effect metadata (parsed from effect string)
       if (loadDefaults) {
         int16_t sOpt;
-        sOpt = extractModeDefaults(fx, "sx");   speed     = (sOpt >= 0) ? sOpt : DEFAULT_SPEED;
-        sOpt = extractModeDefaults(fx, "ix");   intensity = (sOpt >= 0) ? sOpt : DEFAULT_INTENSITY;
-        sOpt = extractModeDefaults(fx, "c1");   custom1   = (sOpt >= 0) ? sOpt : DEFAULT_C1;
-        sOpt = extractModeDefaults(fx, "c2");   custom2   = (sOpt >= 0) ? sOpt : DEFAULT_C2;
-        sOpt = extractModeDefaults(fx, "c3");   custom3   = (sOpt >= 0) ? sOpt : DEFAULT_C3;
-        sOpt = extractModeDefaults(fx, "o1");   check1    = (sOpt >= 0) ? (bool)sOpt : false;
-        sOpt = extractModeDefaults(fx, "o2");   check2    = (sOpt >= 0) ? (bool)sOpt : false;
-        sOpt = extractModeDefaults(fx, "o3");   check3    = (sOpt >= 0) ? (bool)sOpt : false;
-        sOpt = extractModeDefaults(fx, "m12");  if (sOpt >= 0) map1D2D   = constrain(sOpt, 0, 7); else map1D2D = M12_Pixels;  // reset mapping if not defined (2D FX may not work)
-        sOpt = extractModeDefaults(fx, "si");   if (sOpt >= 0) soundSim  = constrain(sOpt, 0, 1);
-        sOpt = extractModeDefaults(fx, "rev");  if (sOpt >= 0) reverse   = (bool)sOpt;
-        sOpt = extractModeDefaults(fx, "mi");   if (sOpt >= 0) mirror    = (bool)sOpt; // NOTE: setting this option is a risky business
-        sOpt = extractModeDefaults(fx, "rY");   if (sOpt >= 0) reverse_y = (bool)sOpt;
-        sOpt = extractModeDefaults(fx, "mY");   if (sOpt >= 0) mirror_y  = (bool)sOpt; // NOTE: setting this option is a risky business
-        sOpt = extractModeDefaults(fx, "pal");  if (sOpt >= 0) setPalette(sOpt); //else setPalette(0);
+        sOpt = strip.getModeDefault(fx, FX_DEF_SX);   speed     = (sOpt >= 0) ? sOpt : DEFAULT_SPEED;
+        sOpt = strip.getModeDefault(fx, FX_DEF_IX);   intensity = (sOpt >= 0) ? sOpt : DEFAULT_INTENSITY;
+        sOpt = strip.getModeDefault(fx, FX_DEF_C1);   custom1   = (sOpt >= 0) ? sOpt : DEFAULT_C1;
+        sOpt = strip.getModeDefault(fx, FX_DEF_C2);   custom2   = (sOpt >= 0) ? sOpt : DEFAULT_C2;
+        sOpt = strip.getModeDefault(fx, FX_DEF_C3);   custom3   = (sOpt >= 0) ? sOpt : DEFAULT_C3;
+        sOpt = strip.getModeDefault(fx, FX_DEF_O1);   check1    = (sOpt >= 0) ? (bool)sOpt : false;
+        sOpt = strip.getModeDefault(fx, FX_DEF_O2);   check2    = (sOpt >= 0) ? (bool)sOpt : false;
+        sOpt = strip.getModeDefault(fx, FX_DEF_O3);   check3    = (sOpt >= 0) ? (bool)sOpt : false;
+        sOpt = strip.getModeDefault(fx, FX_DEF_M12);  if (sOpt >= 0) map1D2D   = constrain(sOpt, 0, 7); else map1D2D = M12_Pixels;  // reset mapping if not defined (2D FX may not work)
+        sOpt = strip.getModeDefault(fx, FX_DEF_SI);   if (sOpt >= 0) soundSim  = constrain(sOpt, 0, 1);
+        sOpt = strip.getModeDefault(fx, FX_DEF_REV);  if (sOpt >= 0) reverse   = (bool)sOpt;
+        sOpt = strip.getModeDefault(fx, FX_DEF_MI);   if (sOpt >= 0) mirror    = (bool)sOpt; // NOTE: setting this option is a risky business
+        sOpt = strip.getModeDefault(fx, FX_DEF_RY);   if (sOpt >= 0) reverse_y = (bool)sOpt;
+        sOpt = strip.getModeDefault(fx, FX_DEF_MY);   if (sOpt >= 0) mirror_y  = (bool)sOpt; // NOTE: setting this option is a risky business
+        sOpt = strip.getModeDefault(fx, FX_DEF_PAL);  if (sOpt >= 0) setPalette(sOpt); //else setPalette(0);
       }
       markForReset();
       stateChanged = true; // send UDP/WS broadcast
@@ -659,8 +808,34 @@ uint16_t Segment::virtualLength() const {
   return vLength;
 }
 
+// selects fastest pixel writer for current segment configuration (before effect function is called)
+// the generic path remains for grouping, spacing, mirroring, dimming, transitions and 1D segments on a matrix
+void Segment::selectPixelWriter() {
+  _pixelWriter = PW_GENERIC;
+  if (grouping != 1 || spacing != 0 || mirror || isInTransition() || currentBri() < 255) return;
+#ifndef WLED_DISABLE_2D
+  if (is2D()) {
+    if (!mirror_y && !transpose) _pixelWriter = PW_2D;
+    return;
+  }
+  if (Segment::maxHeight != 1 && (width() == 1 || height() == 1)) return; // 1D segment on a matrix
+#endif
+  _pixelWriter = reverse ? PW_1D_REVERSE : PW_1D;
+}
+
 void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
 {
+  if (_pixelWriter == PW_1D || _pixelWriter == PW_1D_REVERSE) {
+    // fast path: one physical pixel per virtual pixel
+    const uint16_t len = length();
+    i &= 0xFFFF;
+    if (i >= len) return;
+    if (_pixelWriter == PW_1D_REVERSE) i = (len - 1) - i;
+    i += start + offset;
+    if (i >= stop) i -= len; // wrap
+    strip.setPixelColor(i, col);
+    return;
+  }
   if (!isActive()) return; // not active
 #ifndef WLED_DISABLE_2D
   int vStrip = i>>16; // hack to allow running on virtual strips (2D segment columns/rows)
@@ -688,11 +863,12 @@ void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
         if (i==0)
           setPixelColorXY(0, 0, col);
         else {
-          float step = HALF_PI / (2.85f*i);
-          for (float rad = 0.0f; rad <= HALF_PI+step/2; rad += step) {
+          // 16 bit angle (16384 = HALF_PI) and Q1.15 sin/cos
+          unsigned step = MAX(5749 / i, 1); // HALF_PI / (2.85*i)
+          for (unsigned angle = 0; angle <= 16384 + step/2; angle += step) {
             // may want to try float version as well (with or without antialiasing)
-            int x = roundf(sin_t(rad) * i);
-            int y = roundf(cos_t(rad) * i);
+            int x = (sin_fixed(MIN(angle, 16384U)) * i + 16384) >> 15;
+            int y = (cos_fixed(MIN(angle, 16384U)) * i + 16384) >> 15;
             setPixelColorXY(x, y, col);
           }
           // Bresenham’s Algorithm (may not fill every pixel)
@@ -783,27 +959,28 @@ void Segment::setPixelColor(float i, uint32_t col, bool aa)
 
   if (i<0.0f || i>1.0f) return; // not normalized
 
-  float fC = i * (virtualLength()-1);
+  // position in Q16.16 fixed point
+  uint32_t fC = uint32_t(i * 65536.0f) * (virtualLength()-1);
   if (aa) {
-    uint16_t iL = roundf(fC-0.49f);
-    uint16_t iR = roundf(fC+0.49f);
-    float    dL = (fC - iL)*(fC - iL);
-    float    dR = (iR - fC)*(iR - fC);
+    uint16_t frac = fC & 0xFFFF;
+    uint16_t iL = (fC >> 16) + (frac > 0xFD70); // round to pixel if within 1%
+    uint16_t iR = (fC >> 16) + (frac > 0x028F);
     uint32_t cIL = getPixelColor(iL | (vStrip<<16));
     uint32_t cIR = getPixelColor(iR | (vStrip<<16));
     if (iR!=iL) {
-      // blend L pixel
-      cIL = color_blend(col, cIL, uint8_t(dL*255.0f));
+      uint32_t rFrac = 0x10000 - frac;
+      // blend L pixel (squared distance as blend amount)
+      cIL = color_blend(col, cIL, (uint32_t(frac) * frac) >> 24);
       setPixelColor(iL | (vStrip<<16), cIL);
       // blend R pixel
-      cIR = color_blend(col, cIR, uint8_t(dR*255.0f));
+      cIR = color_blend(col, cIR, (rFrac * rFrac) >> 24);
       setPixelColor(iR | (vStrip<<16), cIR);
     } else {
       // exact match (x & y land on a pixel)
       setPixelColor(iL | (vStrip<<16), col);
     }
   } else {
-    setPixelColor(uint16_t(roundf(fC)) | (vStrip<<16), col);
+    setPixelColor(uint16_t((fC + 0x8000) >> 16) | (vStrip<<16), col);
   }
 }
 
@@ -1135,7 +1312,7 @@ void WS2812FX::finalizeInit(void)
     if (busEnd > _length) _length = busEnd;
     #ifdef ESP8266
     if ((!IS_DIGITAL(bus->getType()) || IS_2PIN(bus->getType()))) continue;
-    uint8_t pins[5];
+    uint8_t pins[WLED_MAX_BUS_PINS];
     if (!bus->getPins(pins)) continue;
     BusDigital* bd = static_cast<BusDigital*>(bus);
     if (pins[0] == 3) bd->reinit();
@@ -1152,15 +1329,45 @@ void WS2812FX::finalizeInit(void)
   DEBUG_PRINTLN(F("Loading custom palettes"));
   loadCustomPalettes(); // (re)load all custom palettes
   DEBUG_PRINTLN(F("Loading custom ledmaps"));
-  deserializeMap();     // (re)load default ledmap
+  if (!isMatrix) deserializeMap(); // (re)load default ledmap (matrix setup already applied it)
 }
 
 void WS2812FX::service() {
   unsigned long nowUp = millis(); // Be aware, millis() rolls over every 49 days
-  now = nowUp + timebase;
-  if (nowUp - _lastShow < MIN_SHOW_DELAY) return;
+#ifdef WLED_ENABLE_FX_REPLAY
+  const bool fixedClock = _fixedClock; // replay: every call is a frame tick at the given time, no scheduler adaption
+  if (fixedClock) nowUp = _fixedTime;
+#else
+  const bool fixedClock = false;
+#endif
+  now = nowUp + (fixedClock ? 0 : timebase);
+#ifndef WLED_DISABLE_FRAME_PACER
+  unsigned long nowUs = fixedClock ? nowUp * 1000UL : micros();
+  bool tick = fixedClock || (long)(nowUs - _nextFrame) >= 0;
+  bool segDue = _nextDue && (long)(nowUp - _nextDue) > 0; // segment due between ticks (effect delay not a multiple of period)
+  if (!tick && (!(_triggered || segDue) || nowUp - _lastShow < MIN_SHOW_DELAY)) return; // extra frames are still rate limited
+#else
+  if (!fixedClock && nowUp - _lastShow < MIN_SHOW_DELAY) return;
+#endif
+#ifdef WLED_ENABLE_DOUBLE_BUFFER
+  if (!presentFrame()) return; // previous frame still waiting for busses, do not overwrite it
+#endif
+#ifndef WLED_DISABLE_FRAME_PACER
+  if (tick && !fixedClock) {
+    bool started = _nextFrame != 0;
+    _nextFrame += _framePeriod; // fixed cadence: a late frame does not delay the following ones
+    if ((long)(nowUs - _nextFrame) >= 0) { // more than a period behind, restart cadence instead of bursting
+      if (started) _missedFrames++;     // first frame only starts the cadence
+      _nextFrame = nowUs + _framePeriod;
+    }
+  }
+  unsigned long earliestDue = 0; // earliest next_time of all segments
+#endif
   bool doShow = false;
+  bool heavyDone = false;   // a throttled (heavy) segment was already rendered in this frame
+  uint32_t frameCost = 0;   // time spent in effect functions (us)
 
+  Segment::compactData(); // no effect is running, data may be moved
   _isServicing = true;
   _segment_index = 0;
   Segment::handleRandomPalette(); // move it into for loop when each segment has individual random palette
@@ -1171,9 +1378,22 @@ void WS2812FX::service() {
     seg.resetIfRequired();
 
     if (!seg.isActive()) continue;
+    if (fixedClock) seg._throttle = 0; // throttling depends on measured render time
 
     // last condition ensures all solid segments are updated at the same time
-    if (nowUp > seg.next_time || _triggered || (doShow && seg.mode == FX_MODE_STATIC))
+    // stagger heavy segments: if one was already rendered postpone others to the next frame (a few times at most)
+    bool due = nowUp > seg.next_time || _triggered || (doShow && seg.mode == FX_MODE_STATIC);
+#ifndef WLED_DISABLE_FRAME_PACER
+    // on a tick the segment is due if next_time is not after the tick time rounded up to the next ms,
+    // else effects returning FRAMETIME would miss every tick by less than 1 ms and run on the ms wake-up
+    if (tick && nowUp + 1 >= seg.next_time) due = true;
+#endif
+    if (due && seg._throttle && heavyDone && seg._deferred < SCHED_MAX_DEFER && !_triggered) {
+      seg._deferred++;
+      due = false;
+    }
+
+    if (due)
     {
       doShow = true;
       uint16_t delay = FRAMETIME;
@@ -1195,6 +1415,8 @@ void WS2812FX::service() {
         // overwritten by later effect. To enable seamless blending for every effect, additional LED buffer
         // would need to be allocated for each effect and then blended together for each pixel.
         [[maybe_unused]] uint8_t tmpMode = seg.currentMode();  // this will return old mode while in transition
+        seg.selectPixelWriter();              // pick fast path for segment configuration (generic during transition)
+        unsigned long renderStart = micros();
         delay = (*_mode[seg.mode])();         // run new/current mode
 #ifndef WLED_DISABLE_MODE_BLEND
         if (modeBlending && seg.mode != tmpMode) {
@@ -1208,19 +1430,46 @@ void WS2812FX::service() {
           Segment::modeBlend(false);          // unset semaphore
         }
 #endif
+        uint32_t cost = micros() - renderStart;
+        seg.resetPixelWriter();               // options may change before next effect call
+        frameCost += cost;
+        seg._renderCost = (seg._renderCost * 7U + MIN(cost, 65535U)) >> 3; // moving average
+        if (seg._throttle) heavyDone = true;
+        seg._deferred = 0;
         if (seg.mode != FX_MODE_HALLOWEEN_EYES) seg.call++;
         if (seg.isInTransition() && delay > FRAMETIME) delay = FRAMETIME; // force faster updates during transition
+        else delay = MIN(delay * (1U + seg._throttle), 65535U); // reduce FPS of heavy segment
       }
 
       seg.next_time = nowUp + delay;
     }
+#ifndef WLED_DISABLE_FRAME_PACER
+    if (!earliestDue || (long)(seg.next_time - earliestDue) < 0) earliestDue = seg.next_time;
+#endif
     if (_segment_index == _queuedChangesSegId) setUpSegmentFromQueuedChanges();
     _segment_index++;
   }
   _virtualSegmentLength = 0;
   busses.setSegmentCCT(-1);
+  #ifndef WLED_DISABLE_2D
+  Segment::purgePolarMaps();  // release polar maps no longer used by any effect
+  #endif
   _isServicing = false;
   _triggered = false;
+#ifndef WLED_DISABLE_FRAME_PACER
+  // wake up for a segment that falls due before the next tick instead of postponing it by a whole period
+  _nextDue = 0;
+  if (earliestDue && (long)(earliestDue - nowUp) * 1000L < (long)(_nextFrame - nowUs)) _nextDue = earliestDue;
+#endif
+  if (doShow && !fixedClock) {
+    _frameCost = frameCost;
+    adjustSchedule();
+#ifndef WLED_DISABLE_FRAME_PACER
+    if (_frameStart) _histInterval.add(frame_hist_t::jitterBin(nowUs - _frameStart, _framePeriod), nowUs - _frameStart);
+    _frameStart = nowUs;
+    _histRender.add(frame_hist_t::log2Bin(frameCost), frameCost);
+#endif
+  }
 
   #ifdef WLED_DEBUG
   if (millis() - nowUp > _frametime) DEBUG_PRINTLN(F("Slow effects."));
@@ -1234,10 +1483,43 @@ void WS2812FX::service() {
   #endif
 }
 
+// throttle the heaviest segment if effects are about to exceed frame time, relax throttling when load is low
+// light segments are never throttled so they keep running at full frame rate
+void WS2812FX::adjustSchedule() {
+  const uint32_t budget = _frametime * 1000U; // us
+  if (_frameCost > budget * SCHED_LOAD_HIGH / 100) {
+    _schedRelax = 0;
+    segment *heaviest = nullptr;
+    for (segment &seg : _segments) {
+      if (!seg.isActive() || seg.freeze || seg._throttle >= SCHED_MAX_THROTTLE) continue;
+      if (!heaviest || seg._renderCost > heaviest->_renderCost) heaviest = &seg;
+    }
+    // only throttle a segment that is responsible for a significant part of the load
+    if (heaviest && heaviest->_renderCost > budget / 4) {
+      heaviest->_throttle++;
+      DEBUG_PRINTF("Sched: load %uus, throttling segment (%uus) to 1/%d\n", (unsigned)_frameCost, (unsigned)heaviest->_renderCost, heaviest->_throttle+1);
+    }
+  } else {
+    // estimated load if all segments rendered in the same frame
+    uint32_t fullCost = 0;
+    for (segment &seg : _segments) if (seg.isActive() && !seg.freeze) fullCost += seg._renderCost;
+    if (fullCost >= budget * SCHED_LOAD_LOW / 100) _schedRelax = 0;
+    else if (++_schedRelax >= SCHED_RELAX_FRAMES) {
+      _schedRelax = 0;
+      for (segment &seg : _segments) {
+        if (seg._throttle) { seg._throttle--; break; }
+      }
+    }
+  }
+}
+
 void IRAM_ATTR WS2812FX::setPixelColor(int i, uint32_t col)
 {
   if (i < customMappingSize) i = customMappingTable[i];
   if (i >= _length) return;
+#ifdef WLED_PIXEL_CANVAS
+  if (_pixels) { _pixels[i] = col; return; } // render into canvas, copied to busses when frame is sent
+#endif
   busses.setPixelColor(i, col);
 }
 
@@ -1245,6 +1527,9 @@ uint32_t WS2812FX::getPixelColor(uint16_t i)
 {
   if (i < customMappingSize) i = customMappingTable[i];
   if (i >= _length) return 0;
+#ifdef WLED_PIXEL_CANVAS
+  if (_pixels) return _pixels[i];
+#endif
   return busses.getPixelColor(i);
 }
 
@@ -1332,7 +1617,51 @@ void WS2812FX::show(void) {
   // avoid race condition, capture _callback value
   show_callback callback = _callback;
   if (callback) callback();
+#ifndef WLED_DISABLE_FRAME_PACER
+  unsigned long showStartUs = micros();
+#endif
+
+#ifdef WLED_ENABLE_RENDER_TASK
+  if (isPipelined()) {
+    // hand finished frame to output task (drop it if output is still busy with previous frames)
+    xSemaphoreTakeRecursive(_renderMutex, portMAX_DELAY);
+    uint32_t *frame = _frameQueue.acquire();
+    if (frame) {
+      memcpy(frame, _pixels, _frameQueue.length() * sizeof(uint32_t));
+      _frameQueue.commit();
+      xTaskNotifyGive(_outputTask);
+    } else _droppedFrames++;
+    xSemaphoreGiveRecursive(_renderMutex);
+  } else
+#endif
+#ifdef WLED_ENABLE_DOUBLE_BUFFER
+  if (isDoubleBuffered()) {
+    _framePending = true; // swap now or as soon as busses finished sending previous frame
+    presentFrame();
+  } else
+#endif
+  showBusses();
+
+  unsigned long showNow = millis();
+#ifndef WLED_DISABLE_FRAME_PACER
+  unsigned long showNowUs = micros();
+  uint32_t showTime = showNowUs - showStartUs;
+  _histShow.add(frame_hist_t::log2Bin(showTime), showTime);
+  size_t diff = showNowUs - _lastShowUs;
+  size_t fpsCurr = 200;
+  if (diff > 0) fpsCurr = MIN(1000000UL / diff, 200UL);
+  _lastShowUs = showNowUs;
+#else
+  size_t diff = showNow - _lastShow;
+  size_t fpsCurr = 200;
+  if (diff > 0) fpsCurr = 1000 / diff;
+#endif
+  _cumulativeFps = (3 * _cumulativeFps + fpsCurr +2) >> 2;   // "+2" for proper rounding (2/4 = 0.5)
+  _lastShow = showNow;
+}
 
+// applies brightness limit and sends pixels to busses
+void WS2812FX::showBusses(void) {
   uint8_t newBri = estimateCurrentAndLimitBri();
   busses.setBrightness(newBri); // "repaints" all pixels if brightness changed
 
@@ -1345,15 +1674,130 @@ void WS2812FX::show(void) {
   // this is done right after show, so this is only OK if LED updates are completed before show() returns
   // or async show has a separate buffer (ESP32 RMT and I2S are ok)
   if (newBri < _brightness) busses.setBrightness(_brightness);
+}
 
-  unsigned long showNow = millis();
-  size_t diff = showNow - _lastShow;
-  size_t fpsCurr = 200;
-  if (diff > 0) fpsCurr = 1000 / diff;
-  _cumulativeFps = (3 * _cumulativeFps + fpsCurr +2) >> 2;   // "+2" for proper rounding (2/4 = 0.5)
-  _lastShow = showNow;
+#ifdef WLED_PIXEL_CANVAS
+// allocates render canvas initialised with current bus content (effects may read previous frame)
+bool WS2812FX::allocateCanvas(void) {
+  if (_pixels) return true;
+  if (!_length) return false;
+  _pixels = (uint32_t*) calloc(_length, sizeof(uint32_t));
+  if (!_pixels) return false;
+  for (unsigned i = 0; i < _length; i++) _pixels[i] = busses.getPixelColor(i);
+  return true;
+}
+
+// copies canvas back to busses and releases it (rendering continues directly into busses)
+void WS2812FX::freeCanvas(void) {
+  if (!_pixels) return;
+  for (unsigned i = 0; i < _length; i++) busses.setPixelColor(i, _pixels[i]);
+  free(_pixels);
+  _pixels = nullptr;
+}
+#endif
+
+#ifdef WLED_ENABLE_DOUBLE_BUFFER
+bool WS2812FX::startDoubleBuffer(void) {
+  _framePending = false;
+  if (!allocateCanvas()) { DEBUG_PRINTLN(F("Double buffer not started.")); return false; }
+  return true;
 }
 
+void WS2812FX::stopDoubleBuffer(void) {
+  while (!presentFrame()) yield(); // do not lose last frame
+  freeCanvas();
+}
+
+// swap barrier: the back buffer is copied to busses only after they finished sending previous frame
+// so rendering never has to wait for (or tear) an ongoing RMT/I2S transfer
+bool WS2812FX::presentFrame(void) {
+  if (!_framePending || !_pixels) return true;
+  if (!busses.canAllShow()) return false;
+  for (unsigned i = 0; i < _length; i++) busses.setPixelColor(i, _pixels[i]);
+  showBusses();
+  _framePending = false;
+  return true;
+}
+#endif
+
+#ifdef WLED_ENABLE_RENDER_TASK
+// allocates render canvas and frame queue and starts render & output tasks (first call)
+// effects are then rendered by render task instead of main loop
+bool WS2812FX::startPipeline(void) {
+  if (!_renderMutex) _renderMutex = xSemaphoreCreateRecursiveMutex();
+  if (!_outputMutex) _outputMutex = xSemaphoreCreateMutex();
+  if (!_renderMutex || !_outputMutex) return false;
+
+  xSemaphoreTakeRecursive(_renderMutex, portMAX_DELAY);
+  xSemaphoreTake(_outputMutex, portMAX_DELAY);
+  bool ok = false;
+  if (!_pixels) {
+    ok = allocateCanvas() && _frameQueue.begin(_length, WLED_RENDER_QUEUE_SLOTS);
+    if (!ok) {
+      freeCanvas();
+      _frameQueue.end();
+    }
+  }
+  xSemaphoreGive(_outputMutex);
+  xSemaphoreGiveRecursive(_renderMutex);
+  if (!ok) { DEBUG_PRINTLN(F("Render pipeline not started.")); return false; }
+
+  // network & UI stay on core 0 (WiFi), rendering runs next to loop() on core 1 with higher priority
+  if (!_renderTask) xTaskCreatePinnedToCore(renderTaskFn, "render", 6144, nullptr, WLED_RENDER_TASK_PRIO, &_renderTask, 1);
+  if (!_outputTask) xTaskCreatePinnedToCore(outputTaskFn, "output", 3072, nullptr, WLED_RENDER_TASK_PRIO, &_outputTask, 0);
+  DEBUG_PRINTF("Render pipeline started: %u pixels, %u frames.\n", _length, _frameQueue.capacity());
+  return true;
+}
+
+// returns rendering to main loop (e.g. before busses are reinitialised); tasks idle until restarted
+void WS2812FX::stopPipeline(void) {
+  if (!_pixels) return;
+  xSemaphoreTakeRecursive(_renderMutex, portMAX_DELAY); // wait for current frame to finish
+  xSemaphoreTake(_outputMutex, portMAX_DELAY);          // wait for output to finish
+  freeCanvas();
+  _frameQueue.end();
+  xSemaphoreGive(_outputMutex);
+  xSemaphoreGiveRecursive(_renderMutex);
+}
+
+// producer: runs effects (same conditions as in WLED::loop())
+void WS2812FX::renderTaskFn(void *param) {
+  WS2812FX *self = WS2812FX::getInstance();
+  for (;;) {
+    bool rendering = self->isPipelined() && (!realtimeMode || realtimeOverride || useMainSegmentOnly);
+    if (rendering) {
+      xSemaphoreTakeRecursive(self->_renderMutex, portMAX_DELAY);
+      if (self->isPipelined() && (!offMode || self->isOffRefreshRequired())) {
+        unsigned long lastShow = self->_lastShow;
+        unsigned long start = micros();
+        self->service();
+        if (self->_lastShow != lastShow) self->_renderTime = micros() - start; // frame was produced
+      }
+      xSemaphoreGiveRecursive(self->_renderMutex);
+    }
+    vTaskDelay(rendering ? 1 : 10); // let loop() run
+  }
+}
+
+// consumer: writes frames to busses and sends them
+void WS2812FX::outputTaskFn(void *param) {
+  WS2812FX *self = WS2812FX::getInstance();
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(50));
+    xSemaphoreTake(self->_outputMutex, portMAX_DELAY);
+    const uint32_t *frame;
+    while (self->isPipelined() && (frame = self->_frameQueue.peek())) {
+      unsigned long start = micros();
+      for (unsigned i = 0; i < self->_frameQueue.length(); i++) busses.setPixelColor(i, frame[i]);
+      self->showBusses();
+      self->_frameQueue.release();
+      self->_outputTime = micros() - start;
+    }
+    xSemaphoreGive(self->_outputMutex);
+  }
+}
+#endif
+
 /**
  * Returns a true value if any of the strips are still being updated.
  * On some hardware (ESP32), strip updates are done asynchronously.
@@ -1371,11 +1815,39 @@ uint16_t WS2812FX::getFps() {
   return _cumulativeFps +1;
 }
 
+#ifdef WLED_ENABLE_FX_REPLAY
+// replaces millis()/micros() in service() with the given time (ms): every call renders the segments due at that time
+// frame pacer statistics and scheduler are not updated meanwhile; disabling restarts the frame cadence
+void WS2812FX::setFixedClock(bool enable, unsigned long time) {
+  _fixedClock = enable;
+  _fixedTime  = time;
+#ifndef WLED_DISABLE_FRAME_PACER
+  if (!enable) _nextFrame = _nextDue = 0;
+#endif
+}
+#endif
+
 void WS2812FX::setTargetFps(uint8_t fps) {
   if (fps > 0 && fps <= 120) _targetFps = fps;
   _frametime = 1000 / _targetFps;
+#ifndef WLED_DISABLE_FRAME_PACER
+  if (_framePeriod != 1000000UL / _targetFps) {
+    _framePeriod = 1000000UL / _targetFps;
+    resetFrameStats(); // statistics of old period are meaningless
+  }
+#endif
 }
 
+#ifndef WLED_DISABLE_FRAME_PACER
+void WS2812FX::resetFrameStats(void) {
+  _histInterval.reset();
+  _histRender.reset();
+  _histShow.reset();
+  _missedFrames = 0;
+  _frameStart = 0;
+}
+#endif
+
 void WS2812FX::setMode(uint8_t segid, uint8_t m) {
   if (segid >= _segments.size()) return;
 
@@ -1386,6 +1858,85 @@ void WS2812FX::setMode(uint8_t segid, uint8_t m) {
   }
 }
 
+// names of segment parameters in defaults section of effect data, order matches mode_default_key_t
+static const char FX_DEFAULT_KEYS[] PROGMEM = "sx,ix,c1,c2,c3,o1,o2,o3,m12,si,rev,mi,rY,mY,pal";
+
+// returns mode_default_key_t for a key name of len characters (or -1 if unknown)
+int8_t WS2812FX::getModeDefaultKey(const char *key, size_t len) {
+  const char *k = FX_DEFAULT_KEYS;
+  for (int8_t i = 0; i < FX_DEF_COUNT; i++) {
+    size_t n = 0;
+    while (n < len && pgm_read_byte(k + n) == key[n]) n++;
+    if (n == len && (pgm_read_byte(k + n) == ',' || pgm_read_byte(k + n) == '\0')) return i;
+    while (pgm_read_byte(k) != ',' && pgm_read_byte(k) != '\0') k++; // skip to next key
+    k++;
+  }
+  return -1;
+}
+
+// parses effect data string (e.g. "Juggle@!,Trail;!,!,;!;sx=16,ix=240,1d") into metadata table
+// so that JSON API and effect changes do not need to scan PROGMEM strings at runtime
+void WS2812FX::parseModeMeta(uint8_t id) {
+  if (id >= _modeMeta.size()) return;
+  mode_meta_t &meta = _modeMeta[id];
+  meta = mode_meta_t();
+  meta.defIndex = _modeDefaults.size();
+
+  char lineBuffer[256];
+  strncpy_P(lineBuffer, _modeData[id], sizeof(lineBuffer)/sizeof(char)-1);
+  lineBuffer[sizeof(lineBuffer)/sizeof(char)-1] = '\0'; // terminate string
+  if (strncmp_P(lineBuffer, PSTR("RSVD"), 4) == 0) meta.flags |= FX_META_RESERVED;
+
+  char *dataPtr = strchr(lineBuffer, '@');
+  meta.nameLen = dataPtr ? dataPtr - lineBuffer : strlen(lineBuffer);
+  if (dataPtr) {
+    meta.flags |= FX_META_DATA;
+    char *sectPtr = strchr(dataPtr, ';');                   // end of slider names
+    if (sectPtr) {
+      meta.sliderEnd = sectPtr - lineBuffer;
+      sectPtr = strchr(sectPtr+1, ';');                     // end of color slot names
+      if (sectPtr) {
+        meta.paletteOfs = sectPtr + 1 - lineBuffer;
+        sectPtr = strchr(sectPtr+1, ';');                   // end of palette
+        if (sectPtr) for (char *c = sectPtr+1; *c && *c != ';'; c++) switch (*c) {
+          case '1': meta.flags |= FX_META_1D;     break;
+          case '2': meta.flags |= FX_META_2D;     break;
+          case 'v': meta.flags |= FX_META_VOLUME; break;
+          case 'f': meta.flags |= FX_META_FREQ;   break;
+        }
+      }
+    }
+  }
+
+  // defaults are in last section of effect data
+  char *defPtr = strrchr(lineBuffer, ';');
+  if (!defPtr) return;
+  uint8_t values[FX_DEF_COUNT];
+  for (char *tok = defPtr+1; *tok; ) {
+    char *end = strchr(tok, ',');
+    if (!end) end = tok + strlen(tok);
+    char *eq = (char*)memchr(tok, '=', end - tok);
+    if (eq) {
+      int8_t key = getModeDefaultKey(tok, eq - tok);
+      if (key >= 0) {
+        meta.defMask |= 1U << key;
+        values[key] = constrain(atoi(eq+1), 0, 255);
+      }
+    }
+    tok = *end ? end+1 : end;
+  }
+  for (size_t i = 0; i < FX_DEF_COUNT; i++) if (meta.defMask & (1U << i)) _modeDefaults.push_back(values[i]);
+}
+
+// returns default value of a segment parameter for effect (-1 if not defined)
+int16_t WS2812FX::getModeDefault(uint8_t id, uint8_t key) {
+  if (id >= _modeMeta.size() || key >= FX_DEF_COUNT) return -1;
+  const mode_meta_t &meta = _modeMeta[id];
+  if (!(meta.defMask & (1U << key))) return -1;
+  size_t idx = meta.defIndex + __builtin_popcount(meta.defMask & ((1U << key) - 1)); // defaults are stored in key order
+  return idx < _modeDefaults.size() ? _modeDefaults[idx] : -1;
+}
+
 //applies to all active and selected segments
 void WS2812FX::setColor(uint8_t slot, uint32_t c) {
   if (slot >= NUM_COLORS) return;
@@ -1417,8 +1968,8 @@ void WS2812FX::setBrightness(uint8_t b, bool direct) {
     }
   }
   // setting brightness with NeoPixelBusLg has no effect on already painted pixels,
-  // so we need to force an update to existing buffer
-  busses.setBrightness(b);
+  // so we need to force an update to existing buffer (output task applies it with next frame)
+  if (!isPipelined()) busses.setBrightness(b);
   if (!direct) {
     unsigned long t = millis();
     if (_segments[0].next_time > t + 22 && t - _lastShow > MIN_SHOW_DELAY) trigger(); //apply brightness change immediately if no refresh soon
@@ -1565,6 +2116,7 @@ void WS2812FX::restartRuntime() {
 void WS2812FX::resetSegments() {
   _segments.clear(); // destructs all Segment as part of clearing
   #ifndef WLED_DISABLE_2D
+  Segment::purgePolarMaps(true);
   segment seg = isMatrix ? Segment(0, Segment::maxWidth, 0, Segment::maxHeight) : Segment(0, _length);
   #else
   segment seg = Segment(0, _length);
@@ -1771,15 +2323,98 @@ void WS2812FX::loadCustomPalettes() {
   }
 }
 
-//load custom mapping table from JSON file (called from finalizeInit() or deserializeState())
+// binary ledmap file (ledmapX.bin) layout (little endian, same as ESP memory layout):
+// 3 bytes magic "WLM", 1 byte version, 2 bytes entry count, followed by entry count uint16_t values
+// (0xFFFF marks unused/missing pixel); it is produced by tools/ledmap2bin.js from ledmapX.json
+#define LEDMAP_BIN_VERSION  1
+#define LEDMAP_BIN_HDRSIZE  6
+#define LEDMAP_BUFSIZE      256
+
+// minimal buffered reader used to parse "map" array of ledmapX.json without
+// materializing it in the global JSON buffer (which is too small for large installations)
+class LedmapStream {
+  public:
+    LedmapStream(File &file) : _file(file), _len(0), _pos(0) {}
+
+    int read() {
+      if (_pos >= _len) {
+        _len = _file.read(_buf, LEDMAP_BUFSIZE);
+        _pos = 0;
+        if (_len == 0) return -1;
+      }
+      return _buf[_pos++];
+    }
+    size_t position() { return _file.position() - _len + _pos; }
+    void   seek(size_t pos) { _file.seek(pos); _len = _pos = 0; }
+
+    // find "map" key and position stream right after opening '[' of its array
+    bool findArray() {
+      const char *key = "\"map\"";
+      size_t index = 0;
+      int c;
+      while ((c = read()) >= 0) {
+        if (c != key[index]) {
+          index = (c == key[0]);
+          continue;
+        }
+        if (key[++index]) continue;
+        index = 0;
+        // matched "map", make sure it is a key followed by an array (and not a string value)
+        while ((c = read()) >= 0 && isspace(c));
+        if (c != ':') continue;
+        while ((c = read()) >= 0 && isspace(c));
+        if (c == '[') return true;
+      }
+      return false;
+    }
+
+    // parse array values up to closing ']', if table is nullptr values are only counted
+    // returns number of values in array (which may be more than tableSize) or 0 if array is unterminated
+    size_t parseArray(uint16_t *table, size_t tableSize) {
+      size_t   count = 0;
+      uint32_t val = 0;
+      bool     isNum = false, isNeg = false;
+      int      c;
+      while ((c = read()) >= 0) {
+        if (c >= '0' && c <= '9') {
+          if (val <= 0xFFFFU) val = val * 10 + (c - '0'); // saturate
+          isNum = true;
+          continue;
+        }
+        if (c == '-') {
+          isNeg = true;
+          continue;
+        }
+        if (isNum) {
+          if (table && count < tableSize) table[count] = (isNeg || val > 0xFFFFU) ? 0xFFFFU : val;
+          count++;
+        }
+        val = 0;
+        isNum = isNeg = false;
+        if (c == ']') return count;
+      }
+      return 0;
+    }
+
+  private:
+    File    &_file;
+    size_t   _len;
+    size_t   _pos;
+    uint8_t  _buf[LEDMAP_BUFSIZE];
+};
+
+//load custom mapping table from binary or JSON file (called from finalizeInit() or deserializeState())
 bool WS2812FX::deserializeMap(uint8_t n) {
   // 2D support creates its own ledmap (on the fly) if a ledmap.json exists it will overwrite built one.
 
   char fileName[32];
   strcpy_P(fileName, PSTR("/ledmap"));
   if (n) sprintf(fileName +7, "%d", n);
-  strcat_P(fileName, PSTR(".json"));
-  bool isFile = WLED_FS.exists(fileName);
+  char *ext = fileName + strlen(fileName);
+  strcpy_P(ext, PSTR(".bin"));
+  bool isBinary = WLED_FS.exists(fileName);
+  if (!isBinary) strcpy_P(ext, PSTR(".json"));
+  bool isFile = isBinary || WLED_FS.exists(fileName);
 
   if (!isFile) {
     // erase custom mapping if selecting nonexistent ledmap.json (n==0)
@@ -1791,15 +2426,12 @@ bool WS2812FX::deserializeMap(uint8_t n) {
     return false;
   }
 
-  if (!requestJSONBufferLock(7)) return false;
-
-  if (!readObjectFromFile(fileName, nullptr, &doc)) {
-    releaseJSONBufferLock();
-    return false; //if file does not exist just exit
-  }
+  File file = WLED_FS.open(fileName, "r");
+  if (!file) return false; //if file does not exist just exit
 
   DEBUG_PRINT(F("Reading LED map from "));
   DEBUG_PRINTLN(fileName);
+  unsigned long start = millis();
 
   // erase old custom ledmap
   if (customMappingTable != nullptr) {
@@ -1808,16 +2440,50 @@ bool WS2812FX::deserializeMap(uint8_t n) {
     customMappingTable = nullptr;
   }
 
-  JsonArray map = doc[F("map")];
-  if (!map.isNull() && map.size()) {  // not an empty map
-    customMappingSize  = map.size();
-    customMappingTable = new uint16_t[customMappingSize];
-    for (unsigned i=0; i<customMappingSize; i++) {
-      customMappingTable[i] = (uint16_t) (map[i]<0 ? 0xFFFFU : map[i]);
+  size_t peakMem = 0;
+  if (isBinary) {
+    uint8_t hdr[LEDMAP_BIN_HDRSIZE];
+    size_t  count = 0;
+    if (file.read(hdr, LEDMAP_BIN_HDRSIZE) == LEDMAP_BIN_HDRSIZE && hdr[0] == 'W' && hdr[1] == 'L' && hdr[2] == 'M' && hdr[3] == LEDMAP_BIN_VERSION) {
+      count = hdr[4] | (hdr[5] << 8);
+      if (file.size() < LEDMAP_BIN_HDRSIZE + count * sizeof(uint16_t)) count = 0; // truncated file
+    } else {
+      DEBUG_PRINTLN(F("Invalid binary LED map."));
+    }
+    if (count) customMappingTable = new uint16_t[count];
+    if (customMappingTable != nullptr) {
+      // read straight into the table in chunks
+      uint8_t *dst = reinterpret_cast<uint8_t*>(customMappingTable);
+      size_t   len = count * sizeof(uint16_t);
+      for (size_t pos = 0; pos < len; ) {
+        size_t chunk = file.read(dst + pos, MIN(len - pos, (size_t)1024));
+        if (chunk == 0) break;
+        pos += chunk;
+        yield();
+      }
+      customMappingSize = count;
+      peakMem = len;
+    }
+  } else {
+    LedmapStream stream(file);
+    if (stream.findArray()) {
+      size_t arrayStart = stream.position();
+      size_t count = stream.parseArray(nullptr, 0); // 1st pass: count entries
+      if (count > UINT16_MAX) count = UINT16_MAX;
+      if (count) customMappingTable = new uint16_t[count];
+      if (customMappingTable != nullptr) {
+        stream.seek(arrayStart);
+        stream.parseArray(customMappingTable, count); // 2nd pass: fill table
+        customMappingSize = count;
+        peakMem = count * sizeof(uint16_t) + sizeof(LedmapStream);
+      }
     }
   }
+  file.close();
 
-  releaseJSONBufferLock();
+  _mapLoadTime = millis() - start;
+  _mapPeakMem  = peakMem;
+  DEBUG_PRINTF("LED map: %u entries, %u ms, %u B peak.\n", (unsigned)customMappingSize, (unsigned)_mapLoadTime, (unsigned)peakMem);
   return true;
 }
 
@@ -8,6 +8,18 @@
 #include "pin_manager.h"
 #include "bus_wrapper.h"
 #include "bus_manager.h"
+#ifdef WLED_ENABLE_PARALLEL_BUS
+  #include <esp_idf_version.h>
+  #if ESP_IDF_VERSION_MAJOR >= 4
+    #include <soc/lldesc.h>
+  #else
+    #include <rom/lldesc.h>
+  #endif
+  #include <soc/i2s_struct.h>
+  #include <soc/gpio_sig_map.h>
+  #include <driver/periph_ctrl.h>
+  #include <esp_heap_caps.h>
+#endif
 
 //colors.cpp
 uint32_t colorBalanceFromKelvin(uint16_t kelvin, uint32_t rgb);
@@ -15,7 +27,9 @@ uint16_t approximateKelvinFromRGB(uint32_t rgb);
 void colorRGBtoRGBW(byte* rgb);
 
 //udp.cpp
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, byte *buffer, uint8_t bri=255, bool isRGBW=false);
+uint8_t realtimeBroadcast(uint8_t type, NetDestination *dest, uint8_t numDest, uint16_t length, byte *buffer, uint8_t bri=255, bool isRGBW=false);
+uint8_t realtimeSendPacket(NetDestination *dest, uint8_t numDest, uint16_t port, const uint8_t *buffer, size_t len);
+extern uint16_t udpPort;
 
 // enable additional debug output
 #if defined(WLED_DEBUG_HOST)
@@ -102,6 +116,7 @@ BusDigital::BusDigital(BusConfig &bc, uint8_t nr, const ColorOrderMap &com)
 , _skip(bc.skipAmount) //sacrificial pixels
 , _colorOrder(bc.colorOrder)
 , _colorOrderMap(com)
+, _encoded(false)
 {
   if (!IS_DIGITAL(bc.type) || !bc.count) return;
   if (!pinManager.allocatePin(bc.pins[0], true, PinOwner::BusDigital)) return;
@@ -126,8 +141,11 @@ BusDigital::BusDigital(BusConfig &bc, uint8_t nr, const ColorOrderMap &com)
   DEBUG_PRINTF("%successfully inited strip %u (len %u) with type %u and pins %u,%u (itype %u)\n", _valid?"S":"Uns", nr, bc.count, bc.type, _pins[0], _pins[1], _iType);
 }
 
-void BusDigital::show() {
-  if (!_valid) return;
+// copies buffered pixels into PolyBus (color order, reversing, skipped LEDs); does not touch hardware
+// so it can run for several busses in parallel before they are shown
+void BusDigital::encode() {
+  if (!_valid || _encoded) return;
+  _encoded = true;
   if (_buffering) { // should be _data != nullptr, but that causes ~20% FPS drop
     size_t channels = Bus::hasWhite(_type) + 3*Bus::hasRGB(_type);
     for (size_t i=0; i<_len; i++) {
@@ -153,6 +171,12 @@ void BusDigital::show() {
     #endif
     for (int i=1; i<_skip; i++) PolyBus::setPixelColor(_busPtr, _iType, i, 0, _colorOrderMap.getPixelColorOrder(_start, _colorOrder)); // paint skipped pixels black
   }
+}
+
+void BusDigital::show() {
+  if (!_valid) return;
+  encode(); // no-op if BusManager already encoded this frame
+  _encoded = false;
   PolyBus::show(_busPtr, _iType, !_buffering); // faster if buffer consistency is not important
 }
 
@@ -464,9 +488,216 @@ uint8_t BusOnOff::getPins(uint8_t* pinArray) {
 }
 
 
+#ifdef WLED_ENABLE_PARALLEL_BUS
+#define PARALLEL_RESET_WORDS  720   // 300us low after each frame (WS2812B-V5 needs > 280us)
+#define PARALLEL_DESC_BYTES   4092  // max. DMA descriptor payload (multiple of 4)
+
+bool BusParallel::_inUse = false;
+
+BusParallel::BusParallel(BusConfig &bc)
+: Bus(bc.type, bc.start, bc.autoWhite, bc.count, bc.reversed)
+, _lanes(0)
+, _colorOrder(bc.colorOrder)
+, _lenPerLane(0)
+, _frameWords(0)
+, _frame(nullptr)
+, _desc(nullptr)
+, _intr(nullptr)
+, _busy(false)
+, _idle(nullptr)
+, _encoded(false)
+{
+  if (_inUse) return;
+  static const uint8_t lanePins[] = {WLED_PARALLEL_PINS};
+  for (size_t i = 0; i < sizeof(lanePins) && _lanes < LANE_MAX_LANES; i++) {
+    if (!pinManager.allocatePin(lanePins[i], true, PinOwner::BusDigital)) { cleanup(); return; }
+    _pins[_lanes++] = lanePins[i];
+  }
+  if (!_lanes) return;
+  _lenPerLane = (_len + _lanes - 1) / _lanes;
+  _frameWords = LaneEncoder::frameWords(_lenPerLane, 3);
+  if (!allocData(_lanes * _lenPerLane * 3)) { cleanup(); return; } // unused tail of last lane stays black
+  _frame = (uint16_t*) heap_caps_calloc(_frameWords + PARALLEL_RESET_WORDS, sizeof(uint16_t), MALLOC_CAP_DMA);
+  _idle  = xSemaphoreCreateBinary();
+  if (!_frame || !_idle || !initI2S()) { cleanup(); return; }
+  _inUse = true;
+  _valid = true;
+  DEBUG_PRINTF("Parallel bus: %u lanes x %u LEDs\n", _lanes, _lenPerLane);
+}
+
+// sets up I2S1 in 16 bit LCD mode at LANE_SLOT_CLOCK with a DMA descriptor chain over the whole frame
+bool BusParallel::initI2S() {
+  size_t bytes = (_frameWords + PARALLEL_RESET_WORDS) * sizeof(uint16_t);
+  size_t numDesc = (bytes + PARALLEL_DESC_BYTES - 1) / PARALLEL_DESC_BYTES;
+  lldesc_t *desc = (lldesc_t*) heap_caps_calloc(numDesc, sizeof(lldesc_t), MALLOC_CAP_DMA);
+  if (!desc) return false;
+  _desc = desc;
+  uint8_t *buf = (uint8_t*) _frame;
+  for (size_t i = 0; i < numDesc; i++) {
+    size_t chunk = MIN(bytes - i*PARALLEL_DESC_BYTES, (size_t)PARALLEL_DESC_BYTES);
+    desc[i].size   = chunk;
+    desc[i].length = chunk;
+    desc[i].buf    = buf + i*PARALLEL_DESC_BYTES;
+    desc[i].owner  = 1;
+    desc[i].eof    = (i == numDesc-1);
+    desc[i].qe.stqe_next = (i == numDesc-1) ? nullptr : &desc[i+1];
+  }
+
+  periph_module_enable(PERIPH_I2S1_MODULE);
+  I2S1.conf.tx_reset = 1;        I2S1.conf.tx_reset = 0;
+  I2S1.conf.tx_fifo_reset = 1;   I2S1.conf.tx_fifo_reset = 0;
+  I2S1.lc_conf.out_rst = 1;      I2S1.lc_conf.out_rst = 0;
+  I2S1.lc_conf.ahbm_rst = 1;     I2S1.lc_conf.ahbm_rst = 0;
+  I2S1.conf2.val = 0;
+  I2S1.conf2.lcd_en = 1;         // parallel output, one bit per lane
+  I2S1.sample_rate_conf.val = 0;
+  I2S1.sample_rate_conf.tx_bits_mod = 16;
+  I2S1.sample_rate_conf.tx_bck_div_num = 2;
+  I2S1.clkm_conf.val = 0;        // 80MHz / (16 + 2/3) / 2 = 2.4MHz
+  I2S1.clkm_conf.clkm_div_num = 16;
+  I2S1.clkm_conf.clkm_div_b = 2;
+  I2S1.clkm_conf.clkm_div_a = 3;
+  I2S1.fifo_conf.val = 0;
+  I2S1.fifo_conf.tx_fifo_mod_force_en = 1;
+  I2S1.fifo_conf.tx_fifo_mod = 1;
+  I2S1.fifo_conf.tx_data_num = 32;
+  I2S1.fifo_conf.dscr_en = 1;
+  I2S1.conf1.val = 0;
+  I2S1.conf1.tx_pcm_bypass = 1;
+  I2S1.conf_chan.val = 0;
+  I2S1.conf_chan.tx_chan_mod = 1;
+  I2S1.timing.val = 0;
+  I2S1.int_ena.val = 0;
+  I2S1.int_clr.val = 0xFFFFFFFF;
+  I2S1.int_ena.out_total_eof = 1;
+  if (esp_intr_alloc(ETS_I2S1_INTR_SOURCE, ESP_INTR_FLAG_IRAM | ESP_INTR_FLAG_LEVEL3, isr, this, &_intr) != ESP_OK) return false;
+
+  for (unsigned l = 0; l < _lanes; l++) {
+    pinMode(_pins[l], OUTPUT);
+    gpio_matrix_out(_pins[l], I2S1O_DATA_OUT8_IDX + l, false, false); // 16 bit LCD mode uses data lines 8-23
+  }
+  return true;
+}
+
+// end of DMA chain: stop I2S (reset period in FIFO keeps lines low)
+void IRAM_ATTR BusParallel::isr(void *arg) {
+  BusParallel *self = (BusParallel*) arg;
+  BaseType_t woken = pdFALSE;
+  if (I2S1.int_st.out_total_eof) {
+    I2S1.conf.tx_start = 0;
+    self->_busy = false;
+    xSemaphoreGiveFromISR(self->_idle, &woken);
+  }
+  I2S1.int_clr.val = I2S1.int_st.val;
+  if (woken) portYIELD_FROM_ISR();
+}
+
+// blocks (without spinning) until the running DMA transfer has ended
+void BusParallel::waitIdle() {
+  // frame takes 30us per LED of a lane plus reset; give up if the interrupt never comes
+  TickType_t timeout = pdMS_TO_TICKS(_lenPerLane * 3 / 100 + 10);
+  while (_busy) {
+    if (xSemaphoreTake(_idle, timeout) != pdTRUE) { DEBUG_PRINTLN(F("Parallel bus: DMA timeout.")); _busy = false; }
+  }
+}
+
+void IRAM_ATTR BusParallel::setPixelColor(uint16_t pix, uint32_t c) {
+  if (!_valid || pix >= _len) return;
+  if (_cct >= 1900) c = colorBalanceFromKelvin(_cct, c); //color correction from CCT
+  uint16_t idx = pix % _lenPerLane;
+  if (_reversed) idx = _lenPerLane - idx - 1;
+  uint8_t *p = _data + ((pix / _lenPerLane) * _lenPerLane + idx) * 3;
+  switch (_colorOrder) { // store in wire order so encoding is a pure bit transpose
+    case COL_ORDER_RGB: p[0] = R(c); p[1] = G(c); p[2] = B(c); break;
+    case COL_ORDER_BRG: p[0] = B(c); p[1] = R(c); p[2] = G(c); break;
+    case COL_ORDER_RBG: p[0] = R(c); p[1] = B(c); p[2] = G(c); break;
+    case COL_ORDER_BGR: p[0] = B(c); p[1] = G(c); p[2] = R(c); break;
+    case COL_ORDER_GBR: p[0] = G(c); p[1] = B(c); p[2] = R(c); break;
+    default:            p[0] = G(c); p[1] = R(c); p[2] = B(c); break;
+  }
+  _encoded = false;
+}
+
+uint32_t BusParallel::getPixelColor(uint16_t pix) {
+  if (!_valid || pix >= _len) return 0;
+  uint16_t idx = pix % _lenPerLane;
+  if (_reversed) idx = _lenPerLane - idx - 1;
+  const uint8_t *p = _data + ((pix / _lenPerLane) * _lenPerLane + idx) * 3;
+  switch (_colorOrder) {
+    case COL_ORDER_RGB: return RGBW32(p[0], p[1], p[2], 0);
+    case COL_ORDER_BRG: return RGBW32(p[1], p[2], p[0], 0);
+    case COL_ORDER_RBG: return RGBW32(p[0], p[2], p[1], 0);
+    case COL_ORDER_BGR: return RGBW32(p[2], p[1], p[0], 0);
+    case COL_ORDER_GBR: return RGBW32(p[2], p[0], p[1], 0);
+    default:            return RGBW32(p[1], p[0], p[2], 0);
+  }
+}
+
+// transposes lanes into the DMA buffer (waits for a running transfer, the buffer is not double buffered)
+void BusParallel::encode() {
+  if (!_valid || _encoded) return;
+  waitIdle();
+  // the 16 bit FIFO sends the upper half of each 32 bit word first
+  LaneEncoder::encode(_frame, _data, _lanes, _lenPerLane, 3, _bri, true);
+  _encoded = true;
+}
+
+// DMA kick
+void BusParallel::show() {
+  if (!_valid) return;
+  encode();
+  waitIdle();
+  xSemaphoreTake(_idle, 0); // drop end of a transfer nobody waited for
+  _busy = true;
+  I2S1.conf.tx_start = 0;
+  I2S1.conf.tx_reset = 1;        I2S1.conf.tx_reset = 0;
+  I2S1.conf.tx_fifo_reset = 1;   I2S1.conf.tx_fifo_reset = 0;
+  I2S1.lc_conf.out_rst = 1;      I2S1.lc_conf.out_rst = 0;
+  I2S1.int_clr.val = 0xFFFFFFFF;
+  I2S1.out_link.addr = (uint32_t) _desc;
+  I2S1.out_link.start = 1;
+  I2S1.conf.tx_start = 1;
+}
+
+uint8_t BusParallel::getPins(uint8_t* pinArray) {
+  for (unsigned l = 0; l < _lanes; l++) pinArray[l] = _pins[l]; // lanes are fixed at compile time
+  return _lanes;
+}
+
+void BusParallel::cleanup() {
+  if (_valid) {
+    waitIdle();
+    _inUse = false;
+  }
+  _valid = false;
+  if (_intr) {
+    I2S1.int_ena.val = 0;
+    esp_intr_free(_intr);
+    periph_module_disable(PERIPH_I2S1_MODULE);
+    _intr = nullptr;
+  }
+  for (unsigned l = 0; l < _lanes; l++) pinManager.deallocatePin(_pins[l], PinOwner::BusDigital);
+  _lanes = 0;
+  if (_idle) { vSemaphoreDelete(_idle); _idle = nullptr; }
+  free(_desc);  _desc  = nullptr;
+  free(_frame); _frame = nullptr;
+  freeData();
+}
+#endif
+
+
 BusNetwork::BusNetwork(BusConfig &bc)
 : Bus(bc.type, bc.start, bc.autoWhite, bc.count)
 , _broadcastLock(false)
+, _prev(nullptr)
+, _deltaSeq(0)
+, _deltaKeyRequested(false)
+, _deltaLastKey(0)
+, _deltaSent(0)
+, _deltaFull(0)
+, _deltaWindow(0)
+, _deltaSentRate(0)
+, _deltaSavedRate(0)
 {
   switch (bc.type) {
     case TYPE_NET_ARTNET_RGB:
@@ -477,14 +708,26 @@ BusNetwork::BusNetwork(BusConfig &bc)
       _rgbw = false;
       _UDPtype = 1;
       break;
+    case TYPE_NET_DELTA_RGB:
+      _rgbw = false;
+      _UDPtype = 3;
+      break;
     default: // TYPE_NET_DDP_RGB / TYPE_NET_DDP_RGBW
       _rgbw = bc.type == TYPE_NET_DDP_RGBW;
       _UDPtype = 0;
       break;
   }
   _UDPchannels = _rgbw ? 4 : 3;
-  _client = IPAddress(bc.pins[0],bc.pins[1],bc.pins[2],bc.pins[3]);
+  _numDest = 0;
+  _dest[_numDest++] = {IPAddress(bc.pins[0],bc.pins[1],bc.pins[2],bc.pins[3]), 0, 0, 0};
+  for (uint8_t i = 0; i < bc.numDest; i++) {
+    _dest[_numDest++] = {IPAddress(bc.dest[i][0],bc.dest[i][1],bc.dest[i][2],bc.dest[i][3]), 0, 0, 0};
+  }
   _valid = (allocData(_len * _UDPchannels) != nullptr);
+  if (_valid && _UDPtype == 3) {
+    _prev = (uint8_t*) calloc(_len, _UDPchannels);
+    _valid = _prev != nullptr;
+  }
 }
 
 void BusNetwork::setPixelColor(uint16_t pix, uint32_t c) {
@@ -507,18 +750,88 @@ uint32_t BusNetwork::getPixelColor(uint16_t pix) {
 void BusNetwork::show() {
   if (!_valid || !canShow()) return;
   _broadcastLock = true;
-  realtimeBroadcast(_UDPtype, _client, _len, _data, _bri, _rgbw);
+  if (_UDPtype == 3) showDelta();
+  else realtimeBroadcast(_UDPtype, _dest, _numDest, _len, _data, _bri, _rgbw);
   _broadcastLock = false;
 }
 
+bool BusNetwork::sendDeltaPacket(uint8_t *pkt, size_t len, uint8_t flags, uint8_t idx) {
+  pkt[0] = UDP_DELTA_PROTOCOL;
+  pkt[1] = UDP_DELTA_KEY_MS * 3 / 1000 + 1; // realtime timeout on receiver (s), outlasts missing keyframes
+  pkt[2] = flags | (_rgbw ? UDP_DELTA_RGBW : 0);
+  pkt[3] = _deltaSeq;
+  pkt[4] = idx;
+  _deltaSent += len * _numDest;
+  return realtimeSendPacket(_dest, _numDest, udpPort, pkt, len) == 0;
+}
+
+void BusNetwork::requestKeyframe(const IPAddress &from) {
+  if (_UDPtype != 3) return;
+  for (uint8_t i = 0; i < _numDest; i++) if (_dest[i].ip == from) { _deltaKeyRequested = true; return; }
+}
+
+// sends only spans of pixels that changed since the previous frame, all pixels in periodic keyframes
+// (or when a receiver reports a lost frame); unchanged frames are not sent at all
+void BusNetwork::showDelta() {
+  const size_t ch = _UDPchannels;
+  uint32_t now = millis();
+  bool key = !_deltaLastKey || now - _deltaLastKey >= UDP_DELTA_KEY_MS || _deltaKeyRequested;
+  if (key) {
+    _deltaLastKey = now | 1;
+    _deltaKeyRequested = false;
+  }
+
+  static uint8_t pkt[UDP_DELTA_MAX_PACKET];
+  size_t  plen = UDP_DELTA_HEADER;
+  uint8_t idx  = 0;
+  auto changed = [&](uint16_t i) {
+    for (size_t c = 0; c < ch; c++) if (scale8(_data[i*ch+c], _bri) != _prev[i*ch+c]) return true;
+    return false;
+  };
+
+  for (uint16_t i = 0; i < _len; ) {
+    if (!key && !changed(i)) { i++; continue; }
+    if (plen + 3 + ch > sizeof(pkt)) { // packet full
+      sendDeltaPacket(pkt, plen, key ? UDP_DELTA_KEY : 0, idx++);
+      plen = UDP_DELTA_HEADER;
+    }
+    uint16_t start = i, end = i+1;
+    size_t room = MIN((sizeof(pkt) - plen - 3) / ch, (size_t)255);
+    for (uint16_t gap = 0, j = i+1; j < _len && j - start < room; j++) {
+      if (key || changed(j)) { end = j+1; gap = 0; }
+      else if (++gap >= UDP_DELTA_MIN_GAP) break;
+    }
+    pkt[plen++] = start >> 8;
+    pkt[plen++] = start & 0xFF;
+    pkt[plen++] = end - start;
+    for (size_t o = start*ch; o < end*ch; o++) pkt[plen++] = _prev[o] = scale8(_data[o], _bri);
+    i = end;
+  }
+  if (plen > UDP_DELTA_HEADER || idx) {
+    sendDeltaPacket(pkt, plen, (key ? UDP_DELTA_KEY : 0) | UDP_DELTA_PUSH, idx);
+    _deltaSeq++;
+  }
+
+  // bytes saved compared to sending every frame in full (DDP: 10 byte header per 1440 channels)
+  _deltaFull += (_len * ch + 10 * ((_len * ch + 1439) / 1440)) * _numDest;
+  if (now - _deltaWindow >= 1000) {
+    _deltaSentRate  = _deltaSent;
+    _deltaSavedRate = (int32_t)_deltaFull - (int32_t)_deltaSent;
+    _deltaSent = _deltaFull = 0;
+    _deltaWindow = now;
+  }
+}
+
 uint8_t BusNetwork::getPins(uint8_t* pinArray) {
   for (uint8_t i = 0; i < 4; i++) {
-    pinArray[i] = _client[i];
+    pinArray[i] = _dest[0].ip[i];
   }
   return 4;
 }
 
 void BusNetwork::cleanup() {
+  free(_prev);
+  _prev = nullptr;
   _type = I_NONE;
   _valid = false;
   freeData();
@@ -529,6 +842,9 @@ void BusNetwork::cleanup() {
 uint32_t BusManager::memUsage(BusConfig &bc) {
   uint8_t type = bc.type;
   uint16_t len = bc.count + bc.skipAmount;
+  #ifdef WLED_ENABLE_PARALLEL_BUS
+  if (type == TYPE_WS2812_PARALLEL) return len*3 + LaneEncoder::frameWords(len, 3)*2; // pixels + DMA frame (rounding to lanes ignored)
+  #endif
   if (type > 15 && type < 32) { // digital types
     if (type == TYPE_UCS8903 || type == TYPE_UCS8904) len *= 2; // 16-bit LEDs
     #ifdef ESP8266
@@ -551,6 +867,10 @@ int BusManager::add(BusConfig &bc) {
   if (getNumBusses() - getNumVirtualBusses() >= WLED_MAX_BUSSES) return -1;
   if (bc.type >= TYPE_NET_DDP_RGB && bc.type < 96) {
     busses[numBusses] = new BusNetwork(bc);
+  #ifdef WLED_ENABLE_PARALLEL_BUS
+  } else if (bc.type == TYPE_WS2812_PARALLEL) {
+    busses[numBusses] = new BusParallel(bc);
+  #endif
   } else if (IS_DIGITAL(bc.type)) {
     busses[numBusses] = new BusDigital(bc, numBusses, colorOrderMap);
   } else if (bc.type == TYPE_ONOFF) {
@@ -558,6 +878,7 @@ int BusManager::add(BusConfig &bc) {
   } else {
     busses[numBusses] = new BusPwm(bc);
   }
+  encodeTime[numBusses] = showTime[numBusses] = 0;
   return numBusses++;
 }
 
@@ -570,9 +891,46 @@ void BusManager::removeAll() {
   numBusses = 0;
 }
 
+void BusManager::encodeBusses(uint8_t first, uint8_t step) {
+  for (uint8_t i = first; i < numBusses; i += step) {
+    unsigned long start = micros();
+    busses[i]->encode();
+    encodeTime[i] = MIN(micros() - start, 65535UL);
+  }
+}
+
+#if defined(ARDUINO_ARCH_ESP32) && !defined(CONFIG_FREERTOS_UNICORE)
+// helper task: encodes odd busses while caller encodes even ones
+void BusManager::encodeTaskFn(void *param) {
+  BusManager *self = (BusManager*) param;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    self->encodeBusses(1, 2);
+    xTaskNotifyGive(self->encodeCaller);
+  }
+}
+#endif
+
+// encode phase (all busses, split across both cores on ESP32) followed by transmit phase
 void BusManager::show() {
+  #if defined(ARDUINO_ARCH_ESP32) && !defined(CONFIG_FREERTOS_UNICORE)
+  if (numBusses > 1 && !encodeTask) {
+    // pinned to the core not running the caller (loop() or render output task)
+    xTaskCreatePinnedToCore(encodeTaskFn, "encode", 2048, this, uxTaskPriorityGet(nullptr), &encodeTask, !xPortGetCoreID());
+  }
+  if (numBusses > 1 && encodeTask) {
+    encodeCaller = xTaskGetCurrentTaskHandle();
+    xTaskNotifyGive(encodeTask);
+    encodeBusses(0, 2);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  } else
+  #endif
+  encodeBusses(0, 1);
+
   for (uint8_t i = 0; i < numBusses; i++) {
+    unsigned long start = micros();
     busses[i]->show();
+    showTime[i] = MIN(micros() - start, 65535UL);
   }
 }
 
@@ -635,6 +993,18 @@ uint16_t BusManager::getTotalLength() {
   return len;
 }
 
+uint32_t BusManager::getDeltaSentRate() {
+  uint32_t rate = 0;
+  for (uint8_t i=0; i<numBusses; i++) if (IS_NETWORK(busses[i]->getType())) rate += static_cast<BusNetwork*>(busses[i])->getDeltaSentRate();
+  return rate;
+}
+
+int32_t BusManager::getDeltaSavedRate() {
+  int32_t rate = 0;
+  for (uint8_t i=0; i<numBusses; i++) if (IS_NETWORK(busses[i]->getType())) rate += static_cast<BusNetwork*>(busses[i])->getDeltaSavedRate();
+  return rate;
+}
+
 // Bus static member definition
 int16_t Bus::_cct = -1;
 uint8_t Bus::_cctBlend = 0;
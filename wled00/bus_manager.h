@@ -21,6 +21,18 @@
 // flag for using double buffering in BusDigital
 extern bool useGlobalLedBuffer;
 
+// parallel lane output is only implemented for I2S1 of classic ESP32
+#if defined(WLED_ENABLE_PARALLEL_BUS) && !(defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_IDF_TARGET_ESP32))
+  #undef WLED_ENABLE_PARALLEL_BUS
+#endif
+#ifdef WLED_ENABLE_PARALLEL_BUS
+  #include "lane_encoder.h"
+  #include <esp_intr_alloc.h>
+  #ifndef WLED_PARALLEL_PINS
+    #define WLED_PARALLEL_PINS 2,4,12,13,14,15,16,17 // one GPIO per lane (max. 16)
+  #endif
+#endif
+
 
 //temporary struct for passing bus configuration to bus
 struct BusConfig {
@@ -35,6 +47,8 @@ struct BusConfig {
   uint8_t pins[5] = {LEDPIN, 255, 255, 255, 255};
   uint16_t frequency;
   bool doubleBuffer;
+  uint8_t numDest = 0;                          // additional network bus destinations
+  uint8_t dest[WLED_MAX_NET_DEST-1][4];
 
   BusConfig(uint8_t busType, uint8_t* ppins, uint16_t pstart, uint16_t len = 1, uint8_t pcolorOrder = COL_ORDER_GRB, bool rev = false, uint8_t skip = 0, byte aw=RGBW_MODE_MANUAL_ONLY, uint16_t clock_kHz=0U, bool dblBfr=false)
   : count(len)
@@ -55,6 +69,13 @@ struct BusConfig {
     for (size_t i = 0; i < nPins; i++) pins[i] = ppins[i];
   }
 
+  //adds a destination (IP address) to a network bus (first destination is stored in pins)
+  bool addDestination(const uint8_t *ip) {
+    if (numDest >= WLED_MAX_NET_DEST-1 || !ip[0]) return false;
+    memcpy(dest[numDest++], ip, 4);
+    return true;
+  }
+
   //validates start and length and extends total if needed
   bool adjustBounds(uint16_t& total) {
     if (!count) count = 1;
@@ -120,6 +141,7 @@ class Bus {
     virtual ~Bus() {} //throw the bus under the bus
 
     virtual void     show() = 0;
+    virtual void     encode()                    {} // prepares output buffer ahead of show(), may run concurrently with other busses
     virtual bool     canShow()                   { return true; }
     virtual void     setStatusPixel(uint32_t c)  {}
     virtual void     setPixelColor(uint16_t pix, uint32_t c) = 0;
@@ -201,6 +223,7 @@ class BusDigital : public Bus {
     ~BusDigital() { cleanup(); }
 
     void show();
+    void encode();
     bool canShow();
     void setBrightness(uint8_t b);
     void setStatusPixel(uint32_t c);
@@ -223,6 +246,7 @@ class BusDigital : public Bus {
     void * _busPtr;
     const ColorOrderMap &_colorOrderMap;
     bool _buffering; // temporary until we figure out why comparison "_data != nullptr" causes severe FPS drop
+    bool _encoded;   // _data already copied to PolyBus by encode()
 
     inline uint32_t restoreColorLossy(uint32_t c, uint8_t restoreBri) {
       if (restoreBri < 255) {
@@ -278,6 +302,54 @@ class BusOnOff : public Bus {
 };
 
 
+#ifdef WLED_ENABLE_PARALLEL_BUS
+// drives equal length WS2812 strips (lanes, pins from WLED_PARALLEL_PINS) with one I2S peripheral in LCD mode
+// LED count of the bus is split evenly across lanes; uses I2S1 so at most 9 other digital busses are possible
+class BusParallel : public Bus {
+  public:
+    BusParallel(BusConfig &bc);
+    ~BusParallel() { cleanup(); }
+
+    void show();
+    void encode();
+    bool canShow()  { return !_busy; }
+    void setPixelColor(uint16_t pix, uint32_t c);
+    uint32_t getPixelColor(uint16_t pix);
+    void setColorOrder(uint8_t colorOrder) { if (colorOrder <= COL_ORDER_MAX) _colorOrder = colorOrder; }
+    uint8_t  getColorOrder() { return _colorOrder; }
+    uint8_t  getPins(uint8_t* pinArray);
+    void cleanup();
+
+  private:
+    uint8_t  _lanes;
+    uint8_t  _colorOrder;
+    uint8_t  _pins[LANE_MAX_LANES];
+    uint16_t _lenPerLane;
+    size_t   _frameWords;
+    uint16_t *_frame;      // DMA buffer: encoded frame followed by reset (all low) period
+    void     *_desc;       // DMA descriptor chain
+    intr_handle_t _intr;
+    volatile bool _busy;   // DMA transfer running
+    SemaphoreHandle_t _idle; // given by isr() at end of transfer
+    bool     _encoded;     // _frame holds current _data
+
+    static bool _inUse;    // only one I2S1
+
+    bool initI2S();
+    void waitIdle();
+    static void isr(void *arg);
+};
+#endif
+
+
+// network bus destination & send statistics
+struct NetDestination {
+  IPAddress ip;
+  uint32_t  packets;  // packets handed to the network stack
+  uint32_t  failed;   // packets the network stack refused
+  uint16_t  sendTime; // average time to send a packet (us)
+};
+
 class BusNetwork : public Bus {
   public:
     BusNetwork(BusConfig &bc);
@@ -292,18 +364,44 @@ class BusNetwork : public Bus {
     void show();
     void cleanup();
 
+    inline uint8_t getNumDestinations() { return _numDest; }
+    inline const NetDestination &getDestination(uint8_t i) { return _dest[i < _numDest ? i : 0]; }
+
+    // a receiver reported a lost frame: next frame is sent as keyframe if it is one of our destinations
+    void requestKeyframe(const IPAddress &from);
+    // delta output statistics of this bus (bytes per second, 0 if not a delta bus)
+    inline uint32_t getDeltaSentRate()  const { return _deltaSentRate; }
+    inline int32_t  getDeltaSavedRate() const { return _deltaSavedRate; }
+
   private:
-    IPAddress _client;
+    NetDestination _dest[WLED_MAX_NET_DEST]; // packets are built once and sent to each
+    uint8_t   _numDest;
     uint8_t   _UDPtype;
     uint8_t   _UDPchannels;
     bool      _rgbw;
     bool      _broadcastLock;
+    uint8_t  *_prev;         // (delta) pixels as last sent (brightness applied)
+    uint8_t   _deltaSeq;
+    bool      _deltaKeyRequested;
+    uint32_t  _deltaLastKey; // millis() of last keyframe
+
+    uint32_t  _deltaSent, _deltaFull, _deltaWindow; // bytes sent/needed for full frames in current 1s window
+    uint32_t  _deltaSentRate;
+    int32_t   _deltaSavedRate;
+
+    void showDelta();
+    bool sendDeltaPacket(uint8_t *pkt, size_t len, uint8_t flags, uint8_t idx);
 };
 
 
 class BusManager {
   public:
-    BusManager() : numBusses(0) {};
+    BusManager() : numBusses(0)
+    #if defined(ARDUINO_ARCH_ESP32) && !defined(CONFIG_FREERTOS_UNICORE)
+    , encodeTask(nullptr)
+    , encodeCaller(nullptr)
+    #endif
+    {};
 
     //utility to get the approx. memory usage of a given BusConfig
     static uint32_t memUsage(BusConfig &bc);
@@ -325,7 +423,12 @@ class BusManager {
 
     //semi-duplicate of strip.getLengthTotal() (though that just returns strip._length, calculated in finalizeInit())
     uint16_t getTotalLength();
+    // delta output statistics summed over all network busses (bytes per second)
+    uint32_t getDeltaSentRate();
+    int32_t  getDeltaSavedRate();
     inline uint8_t getNumBusses() const { return numBusses; }
+    inline uint16_t getEncodeTime(uint8_t busNr) const { return busNr < numBusses ? encodeTime[busNr] : 0; } // us spent preparing bus buffer in last show()
+    inline uint16_t getShowTime(uint8_t busNr)   const { return busNr < numBusses ? showTime[busNr]   : 0; } // us spent starting transmission in last show()
 
     inline void                 updateColorOrderMap(const ColorOrderMap &com) { memcpy(&colorOrderMap, &com, sizeof(ColorOrderMap)); }
     inline const ColorOrderMap& getColorOrderMap() const { return colorOrderMap; }
@@ -334,6 +437,15 @@ class BusManager {
     uint8_t numBusses;
     Bus* busses[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES];
     ColorOrderMap colorOrderMap;
+    uint16_t encodeTime[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES];
+    uint16_t showTime[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES];
+    #if defined(ARDUINO_ARCH_ESP32) && !defined(CONFIG_FREERTOS_UNICORE)
+    TaskHandle_t encodeTask;   // encodes every other bus on the other core
+    TaskHandle_t encodeCaller; // task waiting for encodeTask to finish
+    static void encodeTaskFn(void *param);
+    #endif
+
+    void encodeBusses(uint8_t first, uint8_t step);
 
     inline uint8_t getNumVirtualBusses() {
       int j = 0;
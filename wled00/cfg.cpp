@@ -13,6 +13,17 @@ void getStringFromJson(char* dest, const char* src, size_t len) {
   if (src != nullptr) strlcpy(dest, src, len);
 }
 
+//additional destinations of a network bus, e.g. ["192.168.1.20","239.0.0.10"]
+static void deserializeNetDestinations(BusConfig &bc, JsonArray dst) {
+  if (!IS_NETWORK(bc.type)) return;
+  for (JsonVariant v : dst) {
+    IPAddress ip;
+    if (!v.is<const char*>() || !ip.fromString(v.as<const char*>())) continue;
+    uint8_t addr[4] = {ip[0], ip[1], ip[2], ip[3]};
+    bc.addDestination(addr);
+  }
+}
+
 bool deserializeConfig(JsonObject doc, bool fromFS) {
   bool needsSave = false;
   //int rev_major = doc["rev"][0]; // 1
@@ -161,6 +172,7 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
       uint8_t AWmode = elm[F("rgbwm")] | RGBW_MODE_MANUAL_ONLY;
       if (fromFS) {
         BusConfig bc = BusConfig(ledType, pins, start, length, colorOrder, reversed, skipFirst, AWmode, freqkHz, useGlobalLedBuffer);
+        deserializeNetDestinations(bc, elm[F("dst")]);
         mem += BusManager::memUsage(bc);
         if (useGlobalLedBuffer && start + length > maxlen) {
           maxlen = start + length;
@@ -170,6 +182,7 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
       } else {
         if (busConfigs[s] != nullptr) delete busConfigs[s];
         busConfigs[s] = new BusConfig(ledType, pins, start, length, colorOrder, reversed, skipFirst, AWmode, freqkHz, useGlobalLedBuffer);
+        deserializeNetDestinations(*busConfigs[s], elm[F("dst")]);
         busesChanged = true;
       }
       s++;
@@ -377,6 +390,7 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
   JsonObject def = doc["def"];
   CJSON(bootPreset, def["ps"]);
   CJSON(turnOnAtBoot, def["on"]); // true
+  CJSON(fastBoot, def[F("fb")]);
   CJSON(briS, def["bri"]); // 128
 
   JsonObject interfaces = doc["if"];
@@ -434,6 +448,7 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
   CJSON(arlsForceMaxBri, if_live[F("maxbri")]);
   CJSON(arlsDisableGammaCorrection, if_live[F("no-gc")]); // false
   CJSON(arlsOffset, if_live[F("offset")]); // 0
+  CJSON(realtimeInterpolate, if_live[F("interp")]);
 
   CJSON(alexaEnabled, interfaces["va"][F("alexa")]); // false
 
@@ -588,6 +603,53 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
   return (doc["sv"] | true);
 }
 
+// reads "um" section of cfg.json one usermod section at a time after the rest of the configuration has been applied
+// and released, so peak memory is bounded by the largest usermod section instead of all of them
+// section names are read first (without content); each section is offered to the usermods that did not get a
+// complete configuration yet (usermods ignore sections that are not theirs, see usermod_v2_example.h)
+// usermods without (complete) section get readFromConfig() with an empty object to initialize their defaults,
+// which makes the caller save the configuration
+// must be called with JSON buffer locked
+static bool deserializeUsermodConfigFromFS() {
+  StaticJsonDocument<64> filter;
+  filter["um"]["*"].to<JsonObject>(); // keep section names, drop content
+  doc.clear();
+  char  *names = nullptr;
+  size_t namesLen = 0;
+  bool   readOk = readObjectFromFile("/cfg.json", nullptr, &doc, &filter);
+  if (readOk) {
+    JsonObject um = doc["um"];
+    for (JsonPair kv : um) namesLen += strlen(kv.key().c_str()) + 1;
+    if (namesLen) names = (char*) malloc(namesLen);
+    if (names) {
+      char *n = names;
+      for (JsonPair kv : um) { strcpy(n, kv.key().c_str()); n += strlen(n) + 1; }
+    } else if (namesLen) readOk = false;
+  }
+
+  bool complete[WLED_MAX_USERMODS] = {false};
+  for (const char *name = names; name && name < names + namesLen; name += strlen(name) + 1) {
+    filter.clear();
+    filter["um"][name] = true;
+    doc.clear(); // previous section is released
+    if (!readObjectFromFile("/cfg.json", nullptr, &doc, &filter)) { readOk = false; break; }
+    if (doc.memoryUsage() > cfgPeakMem) cfgPeakMem = doc.memoryUsage();
+    JsonObject umSettings = doc["um"];
+    for (byte i = 0; i < usermods.getModCount(); i++) {
+      if (!complete[i]) complete[i] = usermods.readFromConfig(umSettings, i);
+    }
+  }
+  free(names);
+
+  doc.clear();
+  JsonObject empty = doc.createNestedObject("um");
+  bool allComplete = true;
+  for (byte i = 0; i < usermods.getModCount(); i++) {
+    if (!complete[i] && !usermods.readFromConfig(empty, i)) allComplete = false;
+  }
+  return allComplete || !readOk; // do not overwrite a file that could not be read
+}
+
 void deserializeConfigFromFS() {
   bool success = deserializeConfigSec();
   if (!success) { //if file does not exist, try reading from EEPROM
@@ -600,8 +662,13 @@ void deserializeConfigFromFS() {
   if (!requestJSONBufferLock(1)) return;
 
   DEBUG_PRINTLN(F("Reading settings from /cfg.json..."));
+  unsigned long start = millis();
 
-  success = readObjectFromFile("/cfg.json", nullptr, &doc);
+  // read everything but usermod settings first, those are read section by section afterwards
+  StaticJsonDocument<64> filter;
+  filter["*"]  = true;
+  filter["um"] = false;
+  success = readObjectFromFile("/cfg.json", nullptr, &doc, &filter);
   if (!success) { // if file does not exist, optionally try reading from EEPROM and then save defaults to FS
     releaseJSONBufferLock();
     #ifdef WLED_ADD_EEPROM_SUPPORT
@@ -622,8 +689,12 @@ void deserializeConfigFromFS() {
 
   // NOTE: This routine deserializes *and* applies the configuration
   //       Therefore, must also initialize ethernet from this function
+  cfgPeakMem = doc.memoryUsage();
   bool needsSave = deserializeConfig(doc.as<JsonObject>(), true);
+  needsSave |= !deserializeUsermodConfigFromFS();
   releaseJSONBufferLock();
+  cfgLoadTime = millis() - start;
+  DEBUG_PRINTF("Config read in %lu ms, %u B peak.\n", cfgLoadTime, (unsigned)cfgPeakMem);
 
   if (needsSave) serializeConfig(); // usermods required new parameters
 }
@@ -750,7 +821,7 @@ void serializeConfig() {
     ins["start"] = bus->getStart();
     ins["len"] = bus->getLength();
     JsonArray ins_pin = ins.createNestedArray("pin");
-    uint8_t pins[5];
+    uint8_t pins[WLED_MAX_BUS_PINS];
     uint8_t nPins = bus->getPins(pins);
     for (uint8_t i = 0; i < nPins; i++) ins_pin.add(pins[i]);
     ins[F("order")] = bus->getColorOrder();
@@ -760,6 +831,11 @@ void serializeConfig() {
     ins["ref"] = bus->isOffRefreshRequired();
     ins[F("rgbwm")] = bus->getAutoWhiteMode();
     ins[F("freq")] = bus->getFrequency();
+    if (IS_NETWORK(bus->getType()) && static_cast<BusNetwork*>(bus)->getNumDestinations() > 1) {
+      BusNetwork *nb = static_cast<BusNetwork*>(bus);
+      JsonArray dst = ins.createNestedArray(F("dst"));
+      for (uint8_t i = 1; i < nb->getNumDestinations(); i++) dst.add(nb->getDestination(i).ip.toString());
+    }
   }
 
   JsonArray hw_com = hw.createNestedArray(F("com"));
@@ -844,6 +920,7 @@ void serializeConfig() {
   JsonObject def = doc.createNestedObject("def");
   def["ps"] = bootPreset;
   def["on"] = turnOnAtBoot;
+  def[F("fb")] = fastBoot;
   def["bri"] = briS;
 
   JsonObject interfaces = doc.createNestedObject("if");
@@ -891,6 +968,7 @@ void serializeConfig() {
   if_live[F("maxbri")] = arlsForceMaxBri;
   if_live[F("no-gc")] = arlsDisableGammaCorrection;
   if_live[F("offset")] = arlsOffset;
+  if_live[F("interp")] = realtimeInterpolate;
 
 #ifndef WLED_DISABLE_ALEXA
   JsonObject if_va = interfaces.createNestedObject("va");
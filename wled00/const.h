@@ -194,6 +194,26 @@
 #define REALTIME_MODE_TPM2NET     7
 #define REALTIME_MODE_DDP         8
 
+// WLED-to-WLED delta protocol (TYPE_NET_DELTA_RGB bus -> WLED UDP port of receiver)
+// packet: protocol, timeout (s), flags, frame sequence, packet index, then spans of uint16 start (MSB first), uint8 count, pixels
+#define UDP_DELTA_PROTOCOL    6
+#define UDP_DELTA_HEADER      5
+#define UDP_DELTA_MAX_PACKET  1460
+#define UDP_DELTA_KEY         0x01  // keyframe (all pixels)
+#define UDP_DELTA_PUSH        0x02  // last packet of frame
+#define UDP_DELTA_RGBW        0x04
+#define UDP_DELTA_KEYREQ      0x80  // receiver -> sender: frame lost, send keyframe
+#define UDP_DELTA_KEY_MS      1000  // keyframe interval (ms)
+#define UDP_DELTA_MIN_GAP     3     // fewer unchanged pixels between changes are sent within the span
+
+// realtime recorder (WLED_ENABLE_RT_RECORD)
+#define RTREC_IDLE    0
+#define RTREC_RECORD  1
+#define RTREC_PLAY    2
+
+#define RT_INTERP_MIN_INTERVAL  1    // ms, shorter intervals (frames pushed back to back) are not averaged
+#define RT_INTERP_MAX_INTERVAL  100  // ms, frames of slower sources are shown as received (bounds added latency)
+
 //realtime override modes
 #define REALTIME_OVERRIDE_NONE    0
 #define REALTIME_OVERRIDE_ONCE    1
@@ -236,6 +256,7 @@
 #define TYPE_WS2811_400KHZ       24            //half-speed WS2812 protocol, used by very old WS2811 units
 #define TYPE_TM1829              25
 #define TYPE_UCS8903             26
+#define TYPE_WS2812_PARALLEL     28            //up to 16 equal WS2812 strips as parallel lanes of I2S1 (ESP32, WLED_ENABLE_PARALLEL_BUS)
 #define TYPE_UCS8904             29
 #define TYPE_SK6812_RGBW         30
 #define TYPE_TM1814              31
@@ -256,7 +277,16 @@
 #define TYPE_NET_DDP_RGB         80            //network DDP RGB bus (master broadcast bus)
 #define TYPE_NET_E131_RGB        81            //network E131 RGB bus (master broadcast bus, unused)
 #define TYPE_NET_ARTNET_RGB      82            //network ArtNet RGB bus (master broadcast bus, unused)
+#define TYPE_NET_DELTA_RGB       83            //network WLED-to-WLED bus sending only changed pixels (UDP_DELTA_PROTOCOL)
 #define TYPE_NET_DDP_RGBW        88            //network DDP RGBW bus (master broadcast bus)
+#define IS_NETWORK(t)   ((t) >= 80 && (t) < 96)
+
+#ifndef WLED_MAX_NET_DEST
+  #define WLED_MAX_NET_DEST 4                  //destinations of one network bus (IP in pins + 3 more, unicast or multicast)
+#endif
+
+#define WLED_MAX_BUS_PINS 16                   //size of Bus::getPins() buffer (parallel bus reports one pin per lane)
+#define WLED_MAX_BUS_CFG_PINS 5                //pins configurable per bus (BusConfig, LED settings page)
 
 #define IS_DIGITAL(t) ((t) & 0x10) //digital are 16-31 and 48-63
 #define IS_PWM(t)     ((t) > 40 && (t) < 46)
@@ -352,6 +382,25 @@
 #define ERR_OVERCURRENT 31  // An attached current sensor has measured a current above the threshold (not implemented)
 #define ERR_UNDERVOLT   32  // An attached voltmeter has measured a voltage below the threshold (not implemented)
 
+// Boot phases (see WLED::setup()), timestamps are stored in bootTime[]
+#define BOOT_PHASE_FS             0            //Filesystem mounted and presets file initialized
+#define BOOT_PHASE_CFG            1            //Configuration read (busses created)
+#define BOOT_PHASE_STRIP          2            //Strip initialized, boot preset queued
+#define BOOT_PHASE_LIGHT          3            //First frame with boot preset shown
+#define BOOT_PHASE_UM             4            //Usermods set up
+#define BOOT_PHASE_SERVER         5            //Web server initialized (end of setup())
+#define BOOT_PHASE_NET            6            //Network interfaces initialized (after connection)
+#define BOOT_PHASE_COUNT          7
+
+// Preset apply tracing stages (see presets.cpp)
+#define PRESET_TRACE_QUEUE        0            //Time from applyPreset() request until JSON buffer lock is acquired
+#define PRESET_TRACE_SEEK         1            //Locating preset in presets.json
+#define PRESET_TRACE_PARSE        2            //Reading and parsing preset JSON
+#define PRESET_TRACE_APPLY        3            //Applying state (deserializeState(), stateUpdated())
+#define PRESET_TRACE_TOTAL        4            //From request until transition is started
+#define PRESET_TRACE_PLAYLIST     5            //Playlist entry switch lateness
+#define PRESET_TRACE_STAGES       6
+
 // Timer mode types
 #define NL_MODE_SET               0            //After nightlight time elapsed, set to target brightness
 #define NL_MODE_FADE              1            //Fade to target brightness gradually
@@ -404,6 +453,14 @@
 #define MAX_LEDS_PER_BUS 2048   // may not be enough for fast LEDs (i.e. APA102)
 #endif
 
+// render/output pipeline (WLED_ENABLE_RENDER_TASK)
+#ifndef WLED_RENDER_QUEUE_SLOTS
+  #define WLED_RENDER_QUEUE_SLOTS 3  // frame buffers in queue between render and output task (one is always free)
+#endif
+#ifndef WLED_RENDER_TASK_PRIO
+  #define WLED_RENDER_TASK_PRIO   2  // above loop() (1) so network bursts do not delay frames
+#endif
+
 // string temp buffer (now stored in stack locally)
 #ifdef ESP8266
 #define SETTINGS_STACK_BUF_SIZE 2048
@@ -46,17 +46,37 @@ void handleDDPPacket(e131_packet_t* p) {
   bool push = p->flags & DDP_PUSH_FLAG;
   if (push) {
     e131NewData = true;
+    e131FrameEnd = true;
     byte sn = p->sequenceNum & 0xF;
     if (sn) e131LastSequenceNumber[0] = sn;
   }
 }
 
-//E1.31 and Art-Net protocol support
+static bool    artnetSynced = false; // Art-Net sender uses ArtSync, frames end with the sync packet
+static uint8_t e131MaxUniverse = 0;  // highest universe (index) received, ends frame if the strip is longer than the data sent
+
+static void applyE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol);
+
+//forget frame sync state of the last sender (called when realtime mode ends, the next sender may not use ArtSync)
+void resetE131FrameSync() {
+  artnetSynced = false;
+  e131MaxUniverse = 0;
+}
+
+//E1.31, Art-Net and DDP callback (runs in network task)
 void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
+  strip.lockRender(); // may change segments (effect modes) or write pixels
+  applyE131Packet(p, clientIP, protocol);
+  strip.unlockRender();
+}
+
+//E1.31 and Art-Net protocol support
+static void applyE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
 
   uint16_t uni = 0, dmxChannels = 0;
   uint8_t* e131_data = nullptr;
   uint8_t seq = 0, mde = REALTIME_MODE_E131;
+  bool frameEnd = true;
 
   if (protocol == P_ARTNET)
   {
@@ -64,6 +84,11 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
       handleArtnetPollReply(clientIP);
       return;
     }
+    if (p->art_opcode == ARTNET_OPCODE_OPSYNC) {
+      artnetSynced = true;
+      if (realtimeMode == REALTIME_MODE_ARTNET) e131NewData = e131FrameEnd = true;
+      return;
+    }
     uni = p->art_universe;
     dmxChannels = htons(p->art_length);
     e131_data = p->art_data;
@@ -301,6 +326,10 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
           ledsTotal = totalLen;
         }
 
+        // the universe completing the strip (or the last one the source sends) ends the frame unless Art-Net sync is used
+        if (previousUniverses > e131MaxUniverse) e131MaxUniverse = previousUniverses;
+        frameEnd = !(protocol == P_ARTNET && artnetSynced) && (ledsTotal >= totalLen || previousUniverses == e131MaxUniverse);
+
         if (DMXMode == DMX_MODE_MULTIPLE_DRGB && previousUniverses == 0) {
           if (bri != stripBrightness) {
             bri = stripBrightness;
@@ -328,6 +357,7 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
   }
 
   e131NewData = true;
+  if (frameEnd) e131FrameEnd = true;
 }
 
 void handleArtnetPollReply(IPAddress ipAddress) {
@@ -83,6 +83,7 @@ void handleDMX();
 
 //e131.cpp
 void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol);
+void resetE131FrameSync();
 void handleArtnetPollReply(IPAddress ipAddress);
 void prepareArtnetPollReply(ArtPollReply* reply);
 void sendArtnetPollReply(ArtPollReply* reply, IPAddress ipAddress, uint16_t portAddress);
@@ -92,9 +93,27 @@ bool handleFileRead(AsyncWebServerRequest*, String path);
 bool writeObjectToFileUsingId(const char* file, uint16_t id, JsonDocument* content);
 bool writeObjectToFile(const char* file, const char* key, JsonDocument* content);
 bool readObjectFromFileUsingId(const char* file, uint16_t id, JsonDocument* dest);
-bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest);
+bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest, const JsonDocument* filter = nullptr);
 void updateFSInfo();
 void closeFile();
+void getFileReadTiming(uint32_t &seekUs, uint32_t &parseUs);
+
+//fx_replay.cpp
+#ifdef WLED_ENABLE_FX_REPLAY
+bool requestFxReplay(JsonObject root);
+bool handleFxReplay();
+#endif
+
+//rt_record.cpp
+#ifdef WLED_ENABLE_RT_RECORD
+bool requestRtRecord(JsonObject root);
+void stopRtRecord();
+void recordRealtimePixel(uint16_t i, byte r, byte g, byte b);
+void recordRealtimeFrame();
+void handleRtPlayback();
+uint8_t getRtRecordMode();
+uint32_t getRtRecordFrames();
+#endif
 
 //hue.cpp
 void handleHue();
@@ -217,6 +236,8 @@ void savePreset(byte index, const char* pname = nullptr, JsonObject saveobj = Js
 inline void saveTemporaryPreset() {savePreset(255);};
 void deletePreset(byte index);
 bool getPresetName(byte index, String& name);
+void tracePreset(uint8_t stage, uint32_t us);
+void serializePresetTrace(JsonObject root);
 
 //remote.cpp
 void handleRemote();
@@ -228,11 +249,15 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply=tru
 
 //udp.cpp
 void notify(byte callMode, bool followUp=false);
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri=255, bool isRGBW=false);
+struct NetDestination;
+uint8_t realtimeBroadcast(uint8_t type, NetDestination *dest, uint8_t numDest, uint16_t length, uint8_t *buffer, uint8_t bri=255, bool isRGBW=false);
+uint8_t realtimeSendPacket(NetDestination *dest, uint8_t numDest, uint16_t port, const uint8_t *buffer, size_t len);
+uint32_t getDeltaLostFrames();
 void realtimeLock(uint32_t timeoutMs, byte md = REALTIME_MODE_GENERIC);
 void exitRealtime();
 void handleNotifications();
 void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w);
+void setRealtimePixels(uint16_t i, const byte *rgb, uint16_t count);
 void refreshNodeList();
 void sendSysInfoUDP();
 
@@ -240,6 +265,13 @@ void sendSysInfoUDP();
 int getSignalQuality(int rssi);
 void WiFiEvent(WiFiEvent_t event);
 
+//noise.cpp
+// fill out[i] with inoise8(x + i*dx, y + i*dy[, z + i*dz]) / inoise8_raw() for a row, column or strip
+void inoise8_line(uint8_t *out, unsigned len, uint16_t x, uint16_t dx, uint16_t y, uint16_t dy, uint16_t z, uint16_t dz);
+void inoise8_line(uint8_t *out, unsigned len, uint16_t x, uint16_t dx, uint16_t y, uint16_t dy);
+void inoise8_raw_line(int8_t *out, unsigned len, uint16_t x, uint16_t dx, uint16_t y, uint16_t dy, uint16_t z, uint16_t dz);
+void inoise8_raw_line(int8_t *out, unsigned len, uint16_t x, uint16_t dx, uint16_t y, uint16_t dy);
+
 //um_manager.cpp
 typedef enum UM_Data_Types {
   UMT_BYTE = 0,
@@ -317,6 +349,7 @@ class UsermodManager {
     void readFromJsonState(JsonObject& obj);
     void addToConfig(JsonObject& obj);
     bool readFromConfig(JsonObject& obj);
+    bool readFromConfig(JsonObject& obj, byte mod);
     void onMqttConnect(bool sessionPresent);
     bool onMqttMessage(char* topic, char* payload);
     void onUpdateBegin(bool);
@@ -401,6 +434,12 @@ void clearEEPROM();
   #define fmod_t fmod
   #define floor_t floor
 #endif
+// fixed point: 16 bit angle (65536 = 2*PI), Q1.15 result
+int16_t  sin_fixed(uint16_t angle);
+int16_t  cos_fixed(uint16_t angle);
+uint16_t atan2_fixed(int32_t y, int32_t x);
+uint16_t sqrt_fixed(uint32_t x);
+uint16_t hypot_fixed(int32_t x, int32_t y);
 
 //wled_serial.cpp
 void handleSerial();
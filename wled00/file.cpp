@@ -32,6 +32,14 @@ static volatile size_t knownLargestSpace = MAX_SPACE;
 
 static File f; // don't export to other cpp files
 
+static uint32_t lastSeekTime = 0, lastParseTime = 0; // timing of last readObjectFromFile() in us
+
+// returns time (in us) last readObjectFromFile() spent finding the key and reading/parsing the object
+void getFileReadTiming(uint32_t &seekUs, uint32_t &parseUs) {
+  seekUs  = lastSeekTime;
+  parseUs = lastParseTime;
+}
+
 //wrapper to find out how long closing takes
 void closeFile() {
   #ifdef WLED_DEBUG_FS
@@ -333,13 +341,16 @@ bool readObjectFromFileUsingId(const char* file, uint16_t id, JsonDocument* dest
 }
 
 //if the key is a nullptr, deserialize entire object
-bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest)
+//if filter is given only matching fields are deserialized (useful for large files)
+bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest, const JsonDocument* filter)
 {
   if (doCloseFile) closeFile();
   #ifdef WLED_DEBUG_FS
     DEBUGFS_PRINTF("Read from %s with key %s >>>\n", file, (key==nullptr)?"nullptr":key);
     uint32_t s = millis();
   #endif
+  uint32_t t0 = micros();
+  lastSeekTime = lastParseTime = 0;
   f = WLED_FS.open(file, "r");
   if (!f) return false;
 
@@ -347,11 +358,16 @@ bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest)
   {
     f.close();
     dest->clear();
+    lastSeekTime = micros() - t0;
     DEBUGFS_PRINTLN(F("Obj not found."));
     return false;
   }
+  uint32_t t1 = micros();
+  lastSeekTime = t1 - t0;
 
-  deserializeJson(*dest, f);
+  if (filter) deserializeJson(*dest, f, DeserializationOption::Filter(*filter));
+  else        deserializeJson(*dest, f);
+  lastParseTime = micros() - t1;
 
   f.close();
   DEBUGFS_PRINTF("Read, took %d ms\n", millis() - s);
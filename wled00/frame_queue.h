@@ -0,0 +1,87 @@
+#ifndef WLED_FRAME_QUEUE_H
+#define WLED_FRAME_QUEUE_H
+
+/*
+ * Lock-free single producer / single consumer queue of LED frames
+ * Producer (render task) fills a free slot and commits it, consumer (output task) peeks the oldest
+ * committed frame and releases it when sent. One slot is always kept free to tell full from empty.
+ * Does not depend on Arduino so it can be used in host builds.
+ */
+
+#include <atomic>
+#include <stdint.h>
+#include <stdlib.h>
+
+class FrameQueue {
+  public:
+    FrameQueue() : _buf(nullptr), _len(0), _slots(0), _head(0), _tail(0) {}
+    ~FrameQueue() { end(); }
+
+    // allocates slots of len pixels each (at least 2 slots: 1 usable frame)
+    bool begin(uint16_t len, uint8_t slots = 3) {
+      end();
+      if (len == 0 || slots < 2) return false;
+      _buf = (uint32_t*) calloc((size_t)len * slots, sizeof(uint32_t));
+      if (!_buf) return false;
+      _len   = len;
+      _slots = slots;
+      _head.store(0, std::memory_order_relaxed);
+      _tail.store(0, std::memory_order_relaxed);
+      return true;
+    }
+
+    void end() {
+      free(_buf);
+      _buf   = nullptr;
+      _len   = 0;
+      _slots = 0;
+    }
+
+    // producer: returns free slot to fill or nullptr if queue is full
+    uint32_t *acquire() {
+      if (!_buf) return nullptr;
+      uint8_t head = _head.load(std::memory_order_relaxed);
+      if (next(head) == _tail.load(std::memory_order_acquire)) return nullptr; // full
+      return _buf + (size_t)head * _len;
+    }
+
+    // producer: publishes slot returned by acquire()
+    void commit() {
+      uint8_t head = _head.load(std::memory_order_relaxed);
+      _head.store(next(head), std::memory_order_release);
+    }
+
+    // consumer: returns oldest committed frame or nullptr if queue is empty
+    const uint32_t *peek() const {
+      if (!_buf) return nullptr;
+      uint8_t tail = _tail.load(std::memory_order_relaxed);
+      if (tail == _head.load(std::memory_order_acquire)) return nullptr; // empty
+      return _buf + (size_t)tail * _len;
+    }
+
+    // consumer: frees frame returned by peek()
+    void release() {
+      uint8_t tail = _tail.load(std::memory_order_relaxed);
+      _tail.store(next(tail), std::memory_order_release);
+    }
+
+    uint8_t size() const { // number of committed frames
+      uint8_t head = _head.load(std::memory_order_acquire), tail = _tail.load(std::memory_order_acquire);
+      return head >= tail ? head - tail : head + _slots - tail;
+    }
+
+    inline uint16_t length() const   { return _len; }
+    inline uint8_t  capacity() const { return _slots ? _slots - 1 : 0; }
+    inline bool     isActive() const { return _buf != nullptr; }
+
+  private:
+    inline uint8_t next(uint8_t i) const { return (i + 1 < _slots) ? i + 1 : 0; }
+
+    uint32_t *_buf;
+    uint16_t  _len;
+    uint8_t   _slots;
+    std::atomic<uint8_t> _head; // next slot to be filled by producer
+    std::atomic<uint8_t> _tail; // oldest frame to be consumed
+};
+
+#endif
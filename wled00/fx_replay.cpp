@@ -0,0 +1,238 @@
+#include "wled.h"
+
+/*
+ * Deterministic effect replay (for regression testing of effect optimisations)
+ *
+ * Renders a range of effects on the main segment with a fixed clock, fixed random seed and a
+ * scripted sequence of parameter changes, and writes a hash (and optionally raw pixels) of
+ * every frame to /replay.bin. Use tools/fx_replay.js to trigger a run and compare it with golden frames.
+ * Frames are rendered in short time slices from loop() by calling strip.service() with a fixed clock (frame * dt),
+ * so effect scheduling, mode blending and double buffered output are part of the replay. Other segments keep
+ * their (real time) next update and therefore pause while the replay clock is behind.
+ *
+ * Request (JSON state API):
+ *   {"replay":{"id":1,"fx":[1,186],"n":30,"dt":25,"seed":1337,"dump":false,"seq":[[10,"sx",200],[20,"pal",5]]}}
+ *
+ * File layout (little endian):
+ *   3 bytes "WFR", 1 byte version, uint32 id, uint8 flags (1 = pixels dumped), uint16 frames, uint16 pixels,
+ *   uint16 dt, uint16 seed, uint8 sequence steps, steps * (uint16 frame, uint8 parameter, uint8 value)
+ *   then for every rendered effect: uint8 effect id, frames * ([pixels * uint32 color] + uint32 FNV-1a hash)
+ *
+ * Effects using millis(), hardware random or the random palette are not deterministic.
+ */
+
+#ifdef WLED_ENABLE_FX_REPLAY
+
+#define FX_REPLAY_VERSION  2
+#define FX_REPLAY_MAX_SEQ  8
+#define FX_REPLAY_SLICE_MS 8    // rendering time per loop() call, the rest of WLED keeps running in between
+
+static struct FxReplayJob {
+  bool     pending;   // request waiting to be started
+  bool     running;
+  bool     dump;
+  uint8_t  fxFirst, fxLast;
+  uint16_t frames;
+  uint16_t frameTime;
+  uint16_t seed;
+  uint32_t id;
+  uint8_t  seqCount;
+  struct { uint16_t frame; uint8_t key; uint8_t value; } seq[FX_REPLAY_MAX_SEQ];
+  // state of running replay
+  File     file;
+  Segment *saved;     // main segment as before replay (restored afterwards)
+  bool     blend;
+  bool     pipelined; // render task was stopped for replay
+  uint16_t transition;
+  uint16_t fx;        // effect being rendered
+  uint16_t frame;     // next frame of effect (0 = effect not started)
+  uint16_t rnd;       // random16 seed of replay (other code may use random16 between slices)
+  unsigned long start;
+} fxReplay;
+
+// parses replay request from JSON state API, replay is run from main loop (see handleFxReplay())
+bool requestFxReplay(JsonObject root)
+{
+  if (root.isNull()) return false;
+  JsonVariant fx = root["fx"];
+  if (fx.is<JsonArray>()) {
+    fxReplay.fxFirst = fx[0] | 0;
+    fxReplay.fxLast  = fx[1] | fxReplay.fxFirst;
+  } else {
+    fxReplay.fxFirst = fxReplay.fxLast = fx | 0;
+  }
+  if (fxReplay.fxLast >= strip.getModeCount()) fxReplay.fxLast = strip.getModeCount()-1;
+  fxReplay.frames    = constrain(root["n"] | 30, 1, 1000);
+  fxReplay.frameTime = constrain(root["dt"] | FRAMETIME_FIXED, 1, 1000);
+  fxReplay.seed      = root[F("seed")] | 1337;
+  fxReplay.id        = root["id"] | 0;
+  fxReplay.dump      = root[F("dump")] | false;
+  fxReplay.seqCount  = 0;
+  JsonArray seq = root[F("seq")];
+  for (JsonArray step : seq) {
+    if (fxReplay.seqCount >= FX_REPLAY_MAX_SEQ) break;
+    const char *key = step[1] | "";
+    int8_t k = WS2812FX::getModeDefaultKey(key, strlen(key)); // same parameter names as effect defaults (sx, ix, c1, ...)
+    if (k < 0) continue;
+    fxReplay.seq[fxReplay.seqCount].frame = step[0] | 0;
+    fxReplay.seq[fxReplay.seqCount].key   = k;
+    fxReplay.seq[fxReplay.seqCount].value = step[2] | 0;
+    fxReplay.seqCount++;
+  }
+  fxReplay.pending = fxReplay.fxFirst <= fxReplay.fxLast;
+  return fxReplay.pending;
+}
+
+static void applyReplayStep(Segment &seg, uint8_t key, uint8_t value)
+{
+  switch (key) {
+    case FX_DEF_SX:  seg.speed     = value; break;
+    case FX_DEF_IX:  seg.intensity = value; break;
+    case FX_DEF_C1:  seg.custom1   = value; break;
+    case FX_DEF_C2:  seg.custom2   = value; break;
+    case FX_DEF_C3:  seg.custom3   = value; break;
+    case FX_DEF_O1:  seg.check1    = value; break;
+    case FX_DEF_O2:  seg.check2    = value; break;
+    case FX_DEF_O3:  seg.check3    = value; break;
+    case FX_DEF_M12: seg.map1D2D   = constrain(value, 0, 7); break;
+    case FX_DEF_SI:  seg.soundSim  = constrain(value, 0, 1); break;
+    case FX_DEF_REV: seg.reverse   = value; break;
+    case FX_DEF_MI:  seg.mirror    = value; break;
+    case FX_DEF_RY:  seg.reverse_y = value; break;
+    case FX_DEF_MY:  seg.mirror_y  = value; break;
+    case FX_DEF_PAL: seg.setPalette(value); break;
+  }
+}
+
+// returns false on a short write (file system full), replay is then aborted
+static bool writeReplay(const void *buf, size_t len)
+{
+  return fxReplay.file.write((const uint8_t*)buf, len) == len;
+}
+
+// hashes (and optionally dumps) physical pixels of segment, then writes the hash
+static bool writeReplayFrame(Segment &seg, bool dump)
+{
+  uint32_t hash = 2166136261UL; // FNV-1a
+  for (int y = seg.startY; y < seg.stopY; y++) {
+    for (int x = seg.start; x < seg.stop; x++) {
+      uint32_t c = strip.getPixelColorXY(x, y);
+      for (int b = 0; b < 32; b += 8) { hash ^= (c >> b) & 0xFF; hash *= 16777619UL; }
+      if (dump && !writeReplay(&c, sizeof(c))) return false;
+    }
+  }
+  return writeReplay(&hash, sizeof(hash));
+}
+
+static void finishFxReplay(bool ok)
+{
+  fxReplay.file.close();
+  strip.setFixedClock(false);
+  Segment &seg = strip.getMainSegment();
+  seg = *fxReplay.saved;
+  seg.markForReset();
+  delete fxReplay.saved;
+  fxReplay.saved = nullptr;
+  strip.setTransition(fxReplay.transition);
+  modeBlending = fxReplay.blend;
+  #ifdef WLED_ENABLE_RENDER_TASK
+  if (fxReplay.pipelined) strip.startPipeline();
+  #endif
+  stateChanged = true;
+  fxReplay.running = false;
+  if (!ok) { WLED_FS.remove(F("/replay.tmp")); DEBUG_PRINTLN(F("Replay aborted.")); return; }
+  WLED_FS.remove(F("/replay.bin"));
+  WLED_FS.rename(F("/replay.tmp"), F("/replay.bin"));
+  DEBUG_PRINTF("Replay %u done in %lums.\n", fxReplay.id, millis() - fxReplay.start);
+}
+
+static bool startFxReplay()
+{
+  fxReplay.pending = false;
+  fxReplay.file = WLED_FS.open(F("/replay.tmp"), "w");
+  if (!fxReplay.file) { DEBUG_PRINTLN(F("Replay: cannot create file.")); return false; }
+  Segment &seg = strip.getMainSegment();
+  fxReplay.saved = new Segment(seg);
+  if (!fxReplay.saved) { fxReplay.file.close(); return false; }
+  fxReplay.blend      = modeBlending;
+  fxReplay.transition = strip.getTransition();
+  modeBlending = false;                   // no transitions, effect starts immediately
+  strip.setTransition(0);
+  fxReplay.pipelined = strip.isPipelined();
+  #ifdef WLED_ENABLE_RENDER_TASK
+  if (fxReplay.pipelined) strip.stopPipeline(); // render task must not service main segment between slices
+  #endif
+
+  // run parameters are stored so that results of different runs are not compared
+  uint16_t pixels = seg.width() * seg.height();
+  uint8_t  header[18 + 4*FX_REPLAY_MAX_SEQ] = {'W','F','R',FX_REPLAY_VERSION};
+  memcpy(header+4, &fxReplay.id, 4);
+  header[8] = fxReplay.dump;
+  memcpy(header+9,  &fxReplay.frames, 2);
+  memcpy(header+11, &pixels, 2);
+  memcpy(header+13, &fxReplay.frameTime, 2);
+  memcpy(header+15, &fxReplay.seed, 2);
+  header[17] = fxReplay.seqCount;
+  for (size_t s = 0; s < fxReplay.seqCount; s++) {
+    memcpy(header+18+4*s, &fxReplay.seq[s].frame, 2);
+    header[20+4*s] = fxReplay.seq[s].key;
+    header[21+4*s] = fxReplay.seq[s].value;
+  }
+
+  fxReplay.fx      = fxReplay.fxFirst;
+  fxReplay.frame   = 0;
+  fxReplay.start   = millis();
+  fxReplay.running = true;
+  if (!writeReplay(header, 18 + 4*fxReplay.seqCount)) { finishFxReplay(false); return false; }
+  return true;
+}
+
+// runs pending/active replay for one time slice per call (file stays open between calls)
+// returns true while a replay is running, loop() must then not call service() (replay calls it with a fixed clock)
+bool handleFxReplay()
+{
+  if (fxReplay.pending) {
+    if (fxReplay.running) finishFxReplay(false); // new request replaces running one
+    if (!startFxReplay()) return false;
+  }
+  if (!fxReplay.running) return false;
+
+  Segment &seg = strip.getMainSegment();
+  uint16_t outerSeed = random16_get_seed();
+  random16_set_seed(fxReplay.rnd);
+  unsigned long sliceStart = millis();
+  bool ok = true;
+  while (fxReplay.fx <= fxReplay.fxLast && millis() - sliceStart < FX_REPLAY_SLICE_MS) {
+    #ifdef WLED_ENABLE_DOUBLE_BUFFER
+    if (!strip.presentFrame()) break;     // busses still sending previous frame, service() would not render
+    #endif
+    if (fxReplay.frame == 0) {
+      if (strip.getModeMeta(fxReplay.fx).flags & FX_META_RESERVED) { fxReplay.fx++; continue; }
+      seg = *fxReplay.saved;              // every effect starts from the same segment state
+      seg.mode = 0;
+      seg.setMode(fxReplay.fx, true);     // load effect defaults
+      seg.markForReset();
+      seg.next_time = 0;                  // due at replay time 0
+      random16_set_seed(fxReplay.seed);
+      uint8_t fx = fxReplay.fx;
+      if (!writeReplay(&fx, 1)) { ok = false; break; }
+    }
+    uint16_t frame = fxReplay.frame;
+    for (size_t s = 0; s < fxReplay.seqCount; s++) if (fxReplay.seq[s].frame == frame) applyReplayStep(seg, fxReplay.seq[s].key, fxReplay.seq[s].value);
+    strip.setFixedClock(true, (unsigned long)frame * fxReplay.frameTime);
+    strip.service();                      // renders segments due at that time and shows the frame
+    if (!writeReplayFrame(seg, fxReplay.dump)) { ok = false; break; }
+    if (++fxReplay.frame >= fxReplay.frames) {
+      fxReplay.frame = 0;
+      fxReplay.fx++;
+    }
+  }
+  fxReplay.rnd = random16_get_seed();
+  random16_set_seed(outerSeed);
+
+  if (!ok) finishFxReplay(false);
+  else if (fxReplay.fx > fxReplay.fxLast) finishFxReplay(true);
+  return fxReplay.running;
+}
+
+#endif
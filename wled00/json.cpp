@@ -465,6 +465,14 @@ bool deserializeState(JsonObject root, byte callMode, byte presetId)
     else callMode = CALL_MODE_DIRECT_CHANGE;  // possible bugfix for playlist only containing HTTP API preset FX=~
   }
 
+  #ifdef WLED_ENABLE_FX_REPLAY
+  requestFxReplay(root[F("replay")]);
+  #endif
+
+  #ifdef WLED_ENABLE_RT_RECORD
+  requestRtRecord(root[F("rtrec")]);
+  #endif
+
   if (root.containsKey(F("rmcpal")) && root[F("rmcpal")].as<bool>()) {
     if (strip.customPalettes.size()) {
       char fileName[32];
@@ -609,6 +617,17 @@ void serializeState(JsonObject root, bool forPreset, bool includeBri, bool segme
   }
 }
 
+#ifndef WLED_DISABLE_FRAME_PACER
+static void serializeFrameStats(JsonObject obj, const frame_hist_t &h)
+{
+  obj[F("min")] = h.minVal == UINT32_MAX ? 0 : h.minVal;
+  obj[F("avg")] = h.avg;
+  obj[F("max")] = h.maxVal;
+  JsonArray bins = obj.createNestedArray("h");
+  for (size_t i = 0; i < FRAME_HIST_BINS; i++) bins.add(h.bins[i]);
+}
+#endif
+
 void serializeInfo(JsonObject root)
 {
   root[F("ver")] = versionString;
@@ -648,6 +667,30 @@ void serializeInfo(JsonObject root)
   leds[F("wv")]   = totalLC & 0x02;     // deprecated, true if white slider should be displayed for any segment
   leds["cct"]     = totalLC & 0x04;     // deprecated, use info.leds.lc
 
+  // per bus encode & transmit start time of last frame (us)
+  JsonArray btime = leds.createNestedArray(F("bt"));
+  for (uint8_t b = 0; b < busses.getNumBusses(); b++) {
+    JsonArray bt = btime.createNestedArray();
+    bt.add(busses.getEncodeTime(b));
+    bt.add(busses.getShowTime(b));
+  }
+
+  // network bus destinations: IP, packets sent, failed sends, average send time (us)
+  JsonArray ndest = leds.createNestedArray(F("nd"));
+  for (uint8_t b = 0; b < busses.getNumBusses(); b++) {
+    Bus *bus = busses.getBus(b);
+    if (!bus || !IS_NETWORK(bus->getType())) continue;
+    BusNetwork *nb = static_cast<BusNetwork*>(bus);
+    for (uint8_t i = 0; i < nb->getNumDestinations(); i++) {
+      const NetDestination &d = nb->getDestination(i);
+      JsonArray nd = ndest.createNestedArray();
+      nd.add(d.ip.toString());
+      nd.add(d.packets);
+      nd.add(d.failed);
+      nd.add(d.sendTime);
+    }
+  }
+
   #ifdef WLED_DEBUG
   JsonArray i2c = root.createNestedArray(F("i2c"));
   i2c.add(i2c_sda);
@@ -694,6 +737,13 @@ void serializeInfo(JsonObject root)
   root[F("palcount")] = strip.getPaletteCount();
   root[F("cpalcount")] = strip.customPalettes.size(); //number of custom palettes
 
+  if (strip.getMapSize()) {
+    JsonObject lmap = leds.createNestedObject(F("map"));
+    lmap["n"]      = strip.getMapSize();
+    lmap["t"]      = strip.getMapLoadTime();
+    lmap[F("mem")] = strip.getMapPeakMem();
+  }
+
   JsonArray ledmaps = root.createNestedArray(F("maps"));
   for (size_t i=0; i<WLED_MAX_LEDMAPS; i++) {
     if ((ledMaps>>i) & 0x00000001U) {
@@ -752,6 +802,75 @@ void serializeInfo(JsonObject root)
   #endif
   root[F("uptime")] = millis()/1000 + rolloverMillis*4294967;
 
+  // boot phase timestamps in ms (0 if not reached yet)
+  JsonArray boot = root.createNestedArray(F("boot"));
+  for (size_t i = 0; i < BOOT_PHASE_COUNT; i++) boot.add(bootTime[i]);
+  root[F("fboot")] = fastBoot;
+  serializePresetTrace(root);
+
+  // adaptive scheduler: frame budget and effect time of last frame (us), per active segment [id, avg. cost (us), throttle]
+  JsonObject sched = root.createNestedObject(F("sched"));
+  sched["b"] = strip.getFrameTime() * 1000U;
+  sched["t"] = strip.getFrameCost();
+  JsonArray schedSeg = sched.createNestedArray("seg");
+  for (size_t s = 0; s < strip.getSegmentsNum(); s++) {
+    Segment &sg = strip.getSegment(s);
+    if (!sg.isActive()) continue;
+    JsonArray ss = schedSeg.createNestedArray();
+    ss.add(s);
+    ss.add(sg.getRenderCost());
+    ss.add(sg.getThrottle());
+  }
+
+  #ifndef WLED_DISABLE_FRAME_PACER
+  // frame pacing: target period & missed frames, histograms of frame interval (deviation from period), effect and show time (us)
+  JsonObject frames = root.createNestedObject(F("frames"));
+  frames[F("per")]  = strip.getFramePeriod();
+  frames[F("miss")] = strip.getMissedFrames();
+  serializeFrameStats(frames.createNestedObject(F("int")), strip.getIntervalStats());
+  serializeFrameStats(frames.createNestedObject(F("ren")), strip.getRenderStats());
+  serializeFrameStats(frames.createNestedObject(F("shw")), strip.getShowStats());
+  #endif
+
+  // WLED delta network busses: bytes sent & saved per second (vs. full DDP frames), frames lost as receiver
+  JsonObject delta = root.createNestedObject(F("delta"));
+  delta[F("sent")]  = busses.getDeltaSentRate();
+  delta[F("saved")] = busses.getDeltaSavedRate();
+  delta[F("lost")]  = getDeltaLostFrames();
+
+  #ifdef WLED_ENABLE_RT_RECORD
+  // realtime recorder: mode (0 idle, 1 recording, 2 playing) & frames recorded/played
+  JsonObject rtrec = root.createNestedObject(F("rtrec"));
+  rtrec["m"] = getRtRecordMode();
+  rtrec["f"] = getRtRecordFrames();
+  #endif
+
+  #ifdef WLED_ENABLE_RENDER_TASK
+  // render pipeline: render & output time of last frame (us), frames waiting for output, dropped frames
+  if (strip.isPipelined()) {
+    JsonObject pipe = root.createNestedObject(F("pipe"));
+    pipe["r"]       = strip.getRenderTime();
+    pipe["o"]       = strip.getOutputTime();
+    pipe["q"]       = strip.getQueuedFrames();
+    pipe[F("drop")] = strip.getDroppedFrames();
+  }
+  #endif
+
+  // effect data arena: size, used (incl. headers) & peak bytes, largest free block, fragmentation %, compactions, heap fallbacks
+  const SegmentArena &arena = Segment::getDataArena();
+  JsonObject segdata = root.createNestedObject(F("segdata"));
+  segdata[F("sz")]   = arena.getSize();
+  segdata["u"]       = arena.getUsed();
+  segdata[F("pk")]   = arena.getPeak();
+  segdata[F("lf")]   = arena.getLargestFree();
+  segdata[F("frag")] = arena.getFragmentation();
+  segdata[F("cmp")]  = arena.getCompactions();
+  segdata[F("fb")]   = arena.getFallbacks();
+
+  JsonObject cfg_info = root.createNestedObject(F("cfg"));
+  cfg_info["t"]      = cfgLoadTime;
+  cfg_info[F("mem")] = cfgPeakMem;
+
   char time[32];
   getTimeString(time);
   root[F("time")] = time;
@@ -992,15 +1111,11 @@ void serializeNodes(JsonObject root)
 // deserializes mode data string into JsonArray
 void serializeModeData(JsonArray fxdata)
 {
-  char lineBuffer[256];
   for (size_t i = 0; i < strip.getModeCount(); i++) {
-    strncpy_P(lineBuffer, strip.getModeData(i), sizeof(lineBuffer)/sizeof(char)-1);
-    lineBuffer[sizeof(lineBuffer)/sizeof(char)-1] = '\0'; // terminate string
-    if (lineBuffer[0] != 0) {
-      char* dataPtr = strchr(lineBuffer,'@');
-      if (dataPtr) fxdata.add(dataPtr+1);
-      else         fxdata.add("");
-    }
+    const mode_meta_t &meta = strip.getModeMeta(i);
+    if (meta.nameLen == 0 && !(meta.flags & FX_META_DATA)) continue; // empty effect data
+    if (meta.flags & FX_META_DATA) fxdata.add((const __FlashStringHelper*)(strip.getModeData(i) + meta.nameLen + 1)); // data follows @
+    else                           fxdata.add("");
   }
 }
 
@@ -1008,15 +1123,13 @@ void serializeModeData(JsonArray fxdata)
 // also removes effect data extensions (@...) from deserialised names
 void serializeModeNames(JsonArray arr)
 {
-  char lineBuffer[256];
   for (size_t i = 0; i < strip.getModeCount(); i++) {
-    strncpy_P(lineBuffer, strip.getModeData(i), sizeof(lineBuffer)/sizeof(char)-1);
-    lineBuffer[sizeof(lineBuffer)/sizeof(char)-1] = '\0'; // terminate string
-    if (lineBuffer[0] != 0) {
-      char* dataPtr = strchr(lineBuffer,'@');
-      if (dataPtr) *dataPtr = 0; // terminate mode data after name
-      arr.add(lineBuffer);
-    }
+    const mode_meta_t &meta = strip.getModeMeta(i);
+    if (meta.nameLen == 0 && !(meta.flags & FX_META_DATA)) continue; // empty effect data
+    char name[meta.nameLen+1];
+    strncpy_P(name, strip.getModeData(i), meta.nameLen); // copy name only (using length from metadata)
+    name[meta.nameLen] = '\0';
+    arr.add(name);
   }
 }
 
@@ -1074,7 +1187,9 @@ void serveJson(AsyncWebServerRequest* request)
     return;
   }
 
+  strip.lockRender(); // segments must not change while being serialized (render lock before JSON buffer)
   if (!requestJSONBufferLock(17)) {
+    strip.unlockRender();
     request->send(503, "application/json", F("{\"error\":3}"));
     return;
   }
@@ -1113,6 +1228,7 @@ void serveJson(AsyncWebServerRequest* request)
       }
       //lDoc["m"] = lDoc.memoryUsage(); // JSON buffer usage, for remote debugging
   }
+  strip.unlockRender();
 
   DEBUG_PRINTF("JSON buffer size: %u for request: %d\n", lDoc.memoryUsage(), subJson);
 
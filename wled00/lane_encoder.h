@@ -0,0 +1,67 @@
+#ifndef WLED_LANE_ENCODER_H
+#define WLED_LANE_ENCODER_H
+
+/*
+ * Bit transposing encoder for parallel output of up to 16 WS281x strips (lanes)
+ * Every WS281x bit is sent as 3 slots of a parallel output word (one bit per lane):
+ *   slot 0: all lanes high, slot 1: data bit of each lane, slot 2: all lanes low
+ * which gives a 0.4us/0.8us high time at a slot clock of 2.4 MHz.
+ * Input are lane buffers (bytes in wire order) stored back to back, output one 16 bit word per slot.
+ * Does not depend on Arduino so it can be used in host builds.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define LANE_MAX_LANES       16
+#define LANE_SLOTS_PER_BIT   3
+#define LANE_SLOT_CLOCK      2400000UL  // Hz (WS2812 800 kHz * 3 slots)
+
+class LaneEncoder {
+  public:
+    // number of 16 bit output words for a frame
+    static inline size_t frameWords(uint16_t lenPerLane, uint8_t channels) {
+      return (size_t)lenPerLane * channels * 8 * LANE_SLOTS_PER_BIT;
+    }
+
+    // 8x8 bit matrix transpose: in[l] is the byte of lane l, out[b] holds bit (7-b) of every lane (lane l -> bit l)
+    static inline void transpose8(const uint8_t *in, uint8_t *out) {
+      uint32_t x = ((uint32_t)in[7] << 24) | ((uint32_t)in[6] << 16) | ((uint32_t)in[5] << 8) | in[4];
+      uint32_t y = ((uint32_t)in[3] << 24) | ((uint32_t)in[2] << 16) | ((uint32_t)in[1] << 8) | in[0];
+      uint32_t t;
+      t = (x ^ (x >>  7)) & 0x00AA00AA; x = x ^ t ^ (t <<  7);
+      t = (y ^ (y >>  7)) & 0x00AA00AA; y = y ^ t ^ (t <<  7);
+      t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+      t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+      t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+      y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+      x = t;
+      out[0] = x >> 24; out[1] = x >> 16; out[2] = x >> 8; out[3] = x;
+      out[4] = y >> 24; out[5] = y >> 16; out[6] = y >> 8; out[7] = y;
+    }
+
+    // encodes lanes * lenPerLane * channels bytes from data into frameWords() words
+    // bri scales every byte (255 = unchanged), swapPairs swaps adjacent words (ESP32 I2S 16 bit FIFO order)
+    static void encode(uint16_t *out, const uint8_t *data, uint8_t lanes, uint16_t lenPerLane, uint8_t channels, uint8_t bri = 255, bool swapPairs = false) {
+      if (lanes > LANE_MAX_LANES) lanes = LANE_MAX_LANES;
+      const size_t   stride = (size_t)lenPerLane * channels;
+      const uint16_t mask   = (uint16_t)((1UL << lanes) - 1);
+      const size_t   swap   = swapPairs ? 1 : 0;
+      uint8_t in[LANE_MAX_LANES] = {0};
+      uint8_t lo[8], hi[8] = {0};
+      size_t  k = 0;
+      for (size_t i = 0; i < stride; i++) {
+        const uint8_t *src = data + i;
+        for (unsigned l = 0; l < lanes; l++, src += stride) in[l] = bri == 255 ? *src : (*src * (bri + 1)) >> 8;
+        transpose8(in, lo);
+        if (lanes > 8) transpose8(in + 8, hi);
+        for (unsigned b = 0; b < 8; b++) {
+          out[(k++) ^ swap] = mask;
+          out[(k++) ^ swap] = lo[b] | ((uint16_t)hi[b] << 8);
+          out[(k++) ^ swap] = 0;
+        }
+      }
+    }
+};
+
+#endif
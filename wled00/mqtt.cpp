@@ -90,7 +90,9 @@ void onMqttMessage(char* topic, char* payload, AsyncMqttClientMessageProperties
       topic += topicPrefixLen;
     } else {
       // Non-Wled Topic used here. Probably a usermod subscribed to this topic.
+      strip.lockRender();
       usermods.onMqttMessage(topic, payloadStr);
+      strip.unlockRender();
       delete[] payloadStr;
       payloadStr = nullptr;
       return;
@@ -99,11 +101,13 @@ void onMqttMessage(char* topic, char* payload, AsyncMqttClientMessageProperties
 
   //Prefix is stripped from the topic at this point
 
+  strip.lockRender(); // runs in network task, segments must not change while rendering
   if (strcmp_P(topic, PSTR("/col")) == 0) {
     colorFromDecOrHexString(col, payloadStr);
     colorUpdated(CALL_MODE_DIRECT_CHANGE);
   } else if (strcmp_P(topic, PSTR("/api")) == 0) {
     if (!requestJSONBufferLock(15)) {
+      strip.unlockRender();
       delete[] payloadStr;
       payloadStr = nullptr;
       return;
@@ -124,6 +128,7 @@ void onMqttMessage(char* topic, char* payload, AsyncMqttClientMessageProperties
     // topmost topic (just wled/MAC)
     parseMQTTBriPayload(payloadStr);
   }
+  strip.unlockRender();
   delete[] payloadStr;
   payloadStr = nullptr;
 }
@@ -0,0 +1,137 @@
+#include "wled.h"
+
+/*
+ * Batched Perlin noise for effects
+ *
+ * Follows FastLED inoise8()/inoise8_raw() (same permutation, gradients, easing and interpolation)
+ * so effects look the same, but samples are generated along a line (x + i*dx, y + i*dy[, z + i*dz]), i.e. a row or column of a matrix
+ * or a 1D strip. Neighbouring samples mostly fall into the same lattice cell so cell corner hashes
+ * (12 table lookups per sample in FastLED) are only calculated when the line crosses into a new cell.
+ */
+
+// Ken Perlin's permutation table (first entry repeated so that index 256 wraps around)
+static const uint8_t noiseP[257] PROGMEM = {
+  151,160,137, 91, 90, 15,131, 13,201, 95, 96, 53,194,233,  7,225,
+  140, 36,103, 30, 69,142,  8, 99, 37,240, 21, 10, 23,190,  6,148,
+  247,120,234, 75,  0, 26,197, 62, 94,252,219,203,117, 35, 11, 32,
+   57,177, 33, 88,237,149, 56, 87,174, 20,125,136,171,168, 68,175,
+   74,165, 71,134,139, 48, 27,166, 77,146,158,231, 83,111,229,122,
+   60,211,133,230,220,105, 92, 41, 55, 46,245, 40,244,102,143, 54,
+   65, 25, 63,161,  1,216, 80, 73,209, 76,132,187,208, 89, 18,169,
+  200,196,135,130,116,188,159, 86,164,100,109,198,173,186,  3, 64,
+   52,217,226,250,124,123,  5,202, 38,147,118,126,255, 82, 85,212,
+  207,206, 59,227, 47, 16, 58, 17,182,189, 28, 42,223,183,170,213,
+  119,248,152,  2, 44,154,163, 70,221,153,101,155,167, 43,172,  9,
+  129, 22, 39,253, 19, 98,108,110, 79,113,224,232,178,185,112,104,
+  218,246, 97,228,251, 34,242,193,238,210,144, 12,191,179,162,241,
+   81, 51,145,235,249, 14,239,107, 49,192,214, 31,181,199,106,157,
+  184, 84,204,176,115,121, 50, 45,127,  4,150,254,138,236,205, 93,
+  222,114, 67, 29, 24, 72,243,141,128,195, 78, 66,215, 61,156,180,
+  151
+};
+#define NP(x) pgm_read_byte(&noiseP[(x)])
+
+static inline int8_t grad8(uint8_t hash, int8_t x, int8_t y, int8_t z) {
+  hash &= 0xF;
+  int8_t u = (hash & 8) ? y : x;
+  int8_t v = hash < 4 ? y : (hash == 12 || hash == 14) ? x : z;
+  if (hash & 1) u = -u;
+  if (hash & 2) v = -v;
+  return avg7(u, v);
+}
+
+static inline int8_t grad8(uint8_t hash, int8_t x, int8_t y) {
+  int8_t u, v;
+  if (hash & 4) { u = y; v = x; }
+  else          { u = x; v = y; }
+  if (hash & 1) u = -u;
+  if (hash & 2) v = -v;
+  return avg7(u, v);
+}
+
+// scale raw noise (-64..64) to 0..255 as inoise8() does
+static inline void scaleNoise8(uint8_t *data, unsigned len) {
+  for (unsigned i = 0; i < len; i++) {
+    uint8_t n = int8_t(data[i]) + 64;
+    data[i] = qadd8(n, n);
+  }
+}
+
+void inoise8_raw_line(int8_t *out, unsigned len, uint16_t x, uint16_t dx, uint16_t y, uint16_t dy, uint16_t z, uint16_t dz) {
+  const uint8_t N = 0x80;
+  uint8_t h[8];   // gradient hashes of cell corners
+  uint8_t cX = 0, cY = 0, cZ = 0;
+  bool valid = false;
+
+  for (unsigned i = 0; i < len; i++, x += dx, y += dy, z += dz) {
+    // find the unit cube containing the point and hash its corners (if not done already)
+    uint8_t X = x >> 8;
+    uint8_t Y = y >> 8;
+    uint8_t Z = z >> 8;
+    if (!valid || X != cX || Y != cY || Z != cZ) {
+      uint8_t A  = NP(X)   + Y;
+      uint8_t AA = NP(A)   + Z;
+      uint8_t AB = NP(A+1) + Z;
+      uint8_t B  = NP(X+1) + Y;
+      uint8_t BA = NP(B)   + Z;
+      uint8_t BB = NP(B+1) + Z;
+      h[0] = NP(AA);   h[1] = NP(BA);   h[2] = NP(AB);   h[3] = NP(BB);
+      h[4] = NP(AA+1); h[5] = NP(BA+1); h[6] = NP(AB+1); h[7] = NP(BB+1);
+      cX = X; cY = Y; cZ = Z;
+      valid = true;
+    }
+    // relative position of the point in the cube (and its signed version for gradients)
+    int8_t xx = (uint8_t(x) >> 1) & 0x7F;
+    int8_t yy = (uint8_t(y) >> 1) & 0x7F;
+    int8_t zz = (uint8_t(z) >> 1) & 0x7F;
+    uint8_t u = ease8InOutQuad(uint8_t(x));
+    uint8_t v = ease8InOutQuad(uint8_t(y));
+    uint8_t w = ease8InOutQuad(uint8_t(z));
+
+    int8_t X1 = lerp7by8(grad8(h[0], xx, yy, zz),     grad8(h[1], xx - N, yy, zz),         u);
+    int8_t X2 = lerp7by8(grad8(h[2], xx, yy - N, zz), grad8(h[3], xx - N, yy - N, zz),     u);
+    int8_t X3 = lerp7by8(grad8(h[4], xx, yy, zz - N), grad8(h[5], xx - N, yy, zz - N),     u);
+    int8_t X4 = lerp7by8(grad8(h[6], xx, yy - N, zz - N), grad8(h[7], xx - N, yy - N, zz - N), u);
+    int8_t Y1 = lerp7by8(X1, X2, v);
+    int8_t Y2 = lerp7by8(X3, X4, v);
+    out[i] = lerp7by8(Y1, Y2, w);
+  }
+}
+
+void inoise8_raw_line(int8_t *out, unsigned len, uint16_t x, uint16_t dx, uint16_t y, uint16_t dy) {
+  const uint8_t N = 0x80;
+  uint8_t h[4];   // gradient hashes of cell corners
+  uint8_t cX = 0, cY = 0;
+  bool valid = false;
+
+  for (unsigned i = 0; i < len; i++, x += dx, y += dy) {
+    uint8_t X = x >> 8;
+    uint8_t Y = y >> 8;
+    if (!valid || X != cX || Y != cY) {
+      uint8_t A  = NP(X)   + Y;
+      uint8_t B  = NP(X+1) + Y;
+      h[0] = NP(NP(A));  h[1] = NP(NP(B));
+      h[2] = NP(NP(A+1)); h[3] = NP(NP(B+1));
+      cX = X; cY = Y;
+      valid = true;
+    }
+    int8_t xx = (uint8_t(x) >> 1) & 0x7F;
+    int8_t yy = (uint8_t(y) >> 1) & 0x7F;
+    uint8_t u = ease8InOutQuad(uint8_t(x));
+    uint8_t v = ease8InOutQuad(uint8_t(y));
+
+    int8_t X1 = lerp7by8(grad8(h[0], xx, yy),     grad8(h[1], xx - N, yy),     u);
+    int8_t X2 = lerp7by8(grad8(h[2], xx, yy - N), grad8(h[3], xx - N, yy - N), u);
+    out[i] = lerp7by8(X1, X2, v);
+  }
+}
+
+void inoise8_line(uint8_t *out, unsigned len, uint16_t x, uint16_t dx, uint16_t y, uint16_t dy, uint16_t z, uint16_t dz) {
+  inoise8_raw_line(reinterpret_cast<int8_t*>(out), len, x, dx, y, dy, z, dz);
+  scaleNoise8(out, len);
+}
+
+void inoise8_line(uint8_t *out, unsigned len, uint16_t x, uint16_t dx, uint16_t y, uint16_t dy) {
+  inoise8_raw_line(reinterpret_cast<int8_t*>(out), len, x, dx, y, dy);
+  scaleNoise8(out, len);
+}
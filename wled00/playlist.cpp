@@ -126,6 +126,7 @@ void handlePlaylist() {
   if (currentPlaylist < 0 || playlistEntries == nullptr || fileDoc != nullptr) return;
 
   if (millis() - presetCycledTime > (100*playlistEntryDur)) {
+    if (playlistIndex >= 0) tracePreset(PRESET_TRACE_PLAYLIST, (millis() - presetCycledTime - 100*playlistEntryDur) * 1000); // lateness
     presetCycledTime = millis();
     if (bri == 0 || nightlightActive) return;
 
@@ -16,6 +16,89 @@ static char quickLoad[9];
 static char saveName[33];
 static bool includeBri = true, segBounds = true, selectedOnly = false, playlistSave = false;;
 
+// preset apply tracing
+// each stage has a histogram of power-of-two microsecond buckets (bucket n holds durations < 2^(n+1) us)
+// slow applies are additionally stored in a small ring buffer
+#define PRESET_TRACE_BUCKETS 24  // up to ~16s
+#define PRESET_TRACE_SLOW_N   8  // number of remembered slow events
+#ifndef PRESET_TRACE_SLOW_US
+  #define PRESET_TRACE_SLOW_US 50000 // apply taking longer than this is considered slow
+#endif
+
+typedef struct PresetTraceHist {
+  uint16_t bucket[PRESET_TRACE_BUCKETS];
+  uint32_t count;
+  uint32_t max;
+} preset_trace_hist_t;
+
+typedef struct PresetTraceEvent {
+  uint32_t time;     // uptime in s
+  uint32_t total;    // us
+  uint16_t parse;    // ms
+  uint16_t apply;    // ms
+  byte     preset;
+} preset_trace_event_t;
+
+static preset_trace_hist_t  presetTrace[PRESET_TRACE_STAGES];
+static preset_trace_event_t presetSlow[PRESET_TRACE_SLOW_N];
+static byte                 presetSlowIdx = 0;
+static uint32_t             presetBlocked = 0;     // number of presets that had to wait for locked JSON buffer
+static bool                 presetWaiting = false; // pending preset already counted in presetBlocked
+static uint32_t             presetRequestTime = 0; // micros() of last applyPreset() request
+
+// counts a blocked preset once, not every loop() it keeps waiting
+static void presetIsBlocked() {
+  if (!presetWaiting) presetBlocked++;
+  presetWaiting = true;
+}
+
+void tracePreset(uint8_t stage, uint32_t us) {
+  if (stage >= PRESET_TRACE_STAGES) return;
+  preset_trace_hist_t &h = presetTrace[stage];
+  unsigned b = 0;
+  while (b < PRESET_TRACE_BUCKETS-1 && (us >> (b+1))) b++;
+  if (h.bucket[b] < UINT16_MAX) h.bucket[b]++;
+  h.count++;
+  if (us > h.max) h.max = us;
+}
+
+// returns upper bound of bucket containing given percentile
+static uint32_t presetTracePercentile(const preset_trace_hist_t &h, unsigned pct) {
+  uint32_t sum = 0, total = 0;
+  for (unsigned b = 0; b < PRESET_TRACE_BUCKETS; b++) total += h.bucket[b];
+  if (!total) return 0;
+  uint32_t target = (total * pct + 99) / 100;
+  for (unsigned b = 0; b < PRESET_TRACE_BUCKETS; b++) {
+    sum += h.bucket[b];
+    if (sum >= target) return min(h.max, (uint32_t)(2UL << b));
+  }
+  return h.max;
+}
+
+void serializePresetTrace(JsonObject root) {
+  static const char *stageNames[PRESET_TRACE_STAGES] = {"q", "seek", "parse", "apply", "total", "pl"};
+  JsonObject trace = root.createNestedObject(F("pstrace"));
+  trace["n"]      = presetTrace[PRESET_TRACE_TOTAL].count;
+  trace[F("blk")] = presetBlocked;
+  for (unsigned i = 0; i < PRESET_TRACE_STAGES; i++) {
+    JsonArray stage = trace.createNestedArray(stageNames[i]); // p50, p95, max (us)
+    stage.add(presetTracePercentile(presetTrace[i], 50));
+    stage.add(presetTracePercentile(presetTrace[i], 95));
+    stage.add(presetTrace[i].max);
+  }
+  JsonArray slow = trace.createNestedArray(F("slow")); // [uptime, preset, total us, parse ms, apply ms], oldest first
+  for (unsigned i = 0; i < PRESET_TRACE_SLOW_N; i++) {
+    const preset_trace_event_t &e = presetSlow[(presetSlowIdx + i) % PRESET_TRACE_SLOW_N];
+    if (!e.total) continue;
+    JsonArray ev = slow.createNestedArray();
+    ev.add(e.time);
+    ev.add(e.preset);
+    ev.add(e.total);
+    ev.add(e.parse);
+    ev.add(e.apply);
+  }
+}
+
 static const char *getFileName(bool persist = true) {
   return persist ? "/presets.json" : "/tmp.json";
 }
@@ -24,9 +107,10 @@ static void doSaveState() {
   bool persist = (presetToSave < 251);
   const char *filename = getFileName(persist);
 
-  if (!requestJSONBufferLock(10)) return; // will set fileDoc
-
   initPresetsFile(); // just in case if someone deleted presets.json using /edit
+
+  strip.lockRender(); // segments must not change while being serialized (render lock before JSON buffer)
+  if (!requestJSONBufferLock(10)) { strip.unlockRender(); return; } // will set fileDoc
   JsonObject sObj = doc.to<JsonObject>();
 
   DEBUG_PRINTLN(F("Serialize current state"));
@@ -39,6 +123,7 @@ static void doSaveState() {
   sObj["n"] = saveName;
   if (quickLoad[0]) sObj[F("ql")] = quickLoad;
   if (saveLedmap >= 0) sObj[F("ledmap")] = saveLedmap;
+  strip.unlockRender(); // file is written without render lock
 /*
   #ifdef WLED_DEBUG
     DEBUG_PRINTLN(F("Serialized preset"));
@@ -117,6 +202,7 @@ bool applyPreset(byte index, byte callMode)
   DEBUG_PRINTLN(index);
   presetToApply = index;
   callModeToApply = callMode;
+  presetRequestTime = micros();
   return true;
 }
 
@@ -136,20 +222,28 @@ void handlePresets()
     return;
   }
 
-  if (presetToApply == 0 || fileDoc) return; // no preset waiting to apply, or JSON buffer is already allocated, return to loop until free
+  if (presetToApply == 0) return; // no preset waiting to apply
+  if (fileDoc) { presetIsBlocked(); return; } // JSON buffer is already allocated, return to loop until free
 
   bool changePreset = false;
   uint8_t tmpPreset = presetToApply; // store temporary since deserializeState() may call applyPreset()
   uint8_t tmpMode   = callModeToApply;
+  uint32_t tRequest = presetRequestTime;
+  uint32_t seekTime = 0, parseTime = 0;
 
   JsonObject fdo;
   const char *filename = getFileName(tmpPreset < 255);
 
   // allocate buffer
-  if (!requestJSONBufferLock(9)) return;  // will also assign fileDoc
+  // preset is applied with render lock held, which has to be taken before the JSON buffer (lock order)
+  strip.lockRender();
+  if (!requestJSONBufferLock(9)) { strip.unlockRender(); presetIsBlocked(); return; }  // will also assign fileDoc
+  uint32_t tLocked = micros();
+  tracePreset(PRESET_TRACE_QUEUE, tLocked - tRequest);
 
   presetToApply = 0; //clear request for preset
   callModeToApply = 0;
+  presetWaiting = false;
 
   DEBUG_PRINT(F("Applying preset: "));
   DEBUG_PRINTLN(tmpPreset);
@@ -162,7 +256,12 @@ void handlePresets()
   #endif
   {
   errorFlag = readObjectFromFileUsingId(filename, tmpPreset, fileDoc) ? ERR_NONE : ERR_FS_PLOAD;
+  getFileReadTiming(seekTime, parseTime);
+  tracePreset(PRESET_TRACE_SEEK, seekTime);
   }
+  uint32_t tApply = micros();
+  if (!parseTime) parseTime = tApply - tLocked - seekTime; // RAM buffer
+  tracePreset(PRESET_TRACE_PARSE, parseTime);
   fdo = fileDoc->as<JsonObject>();
 
   //HTTP API commands
@@ -192,7 +291,23 @@ void handlePresets()
 
   releaseJSONBufferLock(); // will also clear fileDoc
   if (changePreset) notify(tmpMode); // force UDP notification
-  stateUpdated(tmpMode);  // was colorUpdated() if anything breaks
+  stateUpdated(tmpMode);  // was colorUpdated() if anything breaks (also starts transition)
+  strip.unlockRender();
+
+  uint32_t tDone = micros();
+  uint32_t total = tDone - tRequest;
+  tracePreset(PRESET_TRACE_APPLY, tDone - tApply);
+  tracePreset(PRESET_TRACE_TOTAL, total);
+  if (total > PRESET_TRACE_SLOW_US) {
+    preset_trace_event_t &e = presetSlow[presetSlowIdx];
+    e.time   = millis()/1000;
+    e.preset = tmpPreset;
+    e.total  = total;
+    e.parse  = min(parseTime/1000, (uint32_t)UINT16_MAX);
+    e.apply  = min((tDone - tApply)/1000, (uint32_t)UINT16_MAX);
+    presetSlowIdx = (presetSlowIdx + 1) % PRESET_TRACE_SLOW_N;
+  }
+
   updateInterfaces(tmpMode);
 }
 
@@ -0,0 +1,267 @@
+#include "wled.h"
+
+/*
+ * Realtime stream recorder & player
+ *
+ * Records frames received via DDP, E1.31 or Art-Net (as sent, before gamma correction and offset)
+ * with their timing to a file, and plays them back through the same realtime frame path
+ * (interpolation, main segment only, gamma etc. apply as for live data) when the source is gone.
+ *
+ * Request (JSON state API):
+ *   {"rtrec":{"rec":true,"file":"/show.wrr"}}   start recording (false stops)
+ *   {"rtrec":{"play":true,"file":"/show.wrr","loop":true}}   start playback (false stops)
+ *
+ * File layout (little endian):
+ *   3 bytes "WRR", 1 byte version, uint16 pixels (RGB, 3 bytes each)
+ *   then per frame: varint ms since previous frame, varint payload length, payload
+ *   payload: pairs of varint unchanged bytes, varint changed bytes followed by the changed bytes
+ *   (difference to previous frame, first frame is relative to black)
+ */
+
+#ifdef WLED_ENABLE_RT_RECORD
+
+#define RTREC_VERSION     1
+#define RTREC_HEADER_SIZE 6
+#define RTREC_BLOCK       4096  // flash is written/read ahead in blocks of at least half this size
+#define RTREC_MIN_SKIP    3     // shorter unchanged runs are stored as changed bytes (cheaper than a new pair)
+
+static struct {
+  uint8_t   mode;       // RTREC_IDLE, RTREC_RECORD, RTREC_PLAY
+  bool      loop;
+  bool      dirty;      // (record) frame changed since last written frame
+  File      file;
+  uint16_t  pixels;
+  uint8_t  *frame;      // current frame
+  uint8_t  *prev;       // (record) last written frame
+  uint8_t  *block;      // write buffer / read-ahead buffer
+  size_t    blockSize;
+  size_t    blockLen;   // bytes in block
+  size_t    blockPos;   // (play) read position
+  bool      eof;        // (play) file completely read into block
+  uint32_t  lastFrame;  // (record) millis() of last frame, (play) millis() of playback start
+  uint32_t  playTime;   // (play) offset of next frame
+  uint32_t  frames;
+} rtRec = {RTREC_IDLE};
+
+static size_t putVarint(uint8_t *p, uint32_t v) {
+  size_t n = 0;
+  for (; v >= 0x80; v >>= 7) p[n++] = (v & 0x7F) | 0x80;
+  p[n++] = v;
+  return n;
+}
+
+// returns bytes used, 0 if p does not hold a complete varint
+static size_t getVarint(const uint8_t *p, size_t len, uint32_t &v) {
+  v = 0;
+  for (size_t n = 0; n < len && n < 5; n++) {
+    v |= (uint32_t)(p[n] & 0x7F) << (7*n);
+    if (!(p[n] & 0x80)) return n+1;
+  }
+  return 0;
+}
+
+static void freeRtRecord() {
+  if (rtRec.file) rtRec.file.close();
+  free(rtRec.frame); rtRec.frame = nullptr;
+  free(rtRec.prev);  rtRec.prev  = nullptr;
+  free(rtRec.block); rtRec.block = nullptr;
+  rtRec.mode = RTREC_IDLE;
+}
+
+static bool allocRtRecord(uint16_t pixels) {
+  size_t frameLen = pixels * 3;
+  rtRec.pixels    = pixels;
+  rtRec.blockSize = RTREC_BLOCK + frameLen * 3 / 2 + 16; // worst case encoded frame always fits after a flush/refill
+  rtRec.frame = (uint8_t*) calloc(frameLen, 1);
+  rtRec.prev  = (uint8_t*) calloc(frameLen, 1);
+  rtRec.block = (uint8_t*) malloc(rtRec.blockSize);
+  rtRec.blockLen = rtRec.blockPos = 0;
+  rtRec.frames = 0;
+  if (rtRec.frame && rtRec.prev && rtRec.block) return true;
+  freeRtRecord();
+  return false;
+}
+
+static void flushRtRecord() {
+  if (rtRec.blockLen) rtRec.file.write(rtRec.block, rtRec.blockLen);
+  rtRec.blockLen = 0;
+}
+
+void stopRtRecord() {
+  if (rtRec.mode == RTREC_RECORD) {
+    flushRtRecord();
+    DEBUG_PRINTF("Recorded %u frames.\n", rtRec.frames);
+  }
+  freeRtRecord();
+}
+
+static bool startRtRecord(const char *name) {
+  stopRtRecord();
+  if (!allocRtRecord(strip.getLengthTotal())) return false;
+  rtRec.file = WLED_FS.open(name, "w");
+  if (!rtRec.file) { freeRtRecord(); return false; }
+  uint8_t header[RTREC_HEADER_SIZE] = {'W','R','R',RTREC_VERSION};
+  memcpy(header+4, &rtRec.pixels, 2);
+  rtRec.file.write(header, sizeof(header));
+  rtRec.lastFrame = 0;
+  rtRec.dirty = false;
+  rtRec.mode = RTREC_RECORD;
+  return true;
+}
+
+static bool startRtPlayback(const char *name, bool loop) {
+  stopRtRecord();
+  File f = WLED_FS.open(name, "r");
+  uint8_t header[RTREC_HEADER_SIZE];
+  if (!f || f.read(header, sizeof(header)) != sizeof(header) || memcmp(header, "WRR", 3) || header[3] != RTREC_VERSION) {
+    if (f) f.close();
+    return false;
+  }
+  uint16_t pixels;
+  memcpy(&pixels, header+4, 2);
+  if (!allocRtRecord(pixels)) { f.close(); return false; }
+  rtRec.file = f;
+  rtRec.loop = loop;
+  rtRec.eof  = false;
+  rtRec.lastFrame = millis();
+  rtRec.playTime = 0;
+  rtRec.mode = RTREC_PLAY;
+  return true;
+}
+
+bool requestRtRecord(JsonObject root) {
+  if (root.isNull()) return false;
+  const char *name = root["file"] | "/show.wrr";
+  if (root.containsKey(F("rec"))) {
+    if (root[F("rec")]) return startRtRecord(name);
+    if (rtRec.mode == RTREC_RECORD) stopRtRecord();
+  }
+  if (root.containsKey(F("play"))) {
+    if (root[F("play")]) return startRtPlayback(name, root[F("loop")] | false);
+    if (rtRec.mode == RTREC_PLAY) stopRtRecord();
+  }
+  return true;
+}
+
+// ingest hooks (realtime index, raw values as received)
+void recordRealtimePixel(uint16_t i, byte r, byte g, byte b) {
+  if (rtRec.mode != RTREC_RECORD || i >= rtRec.pixels) return;
+  uint8_t *p = rtRec.frame + i*3;
+  p[0] = r; p[1] = g; p[2] = b;
+  rtRec.dirty = true;
+}
+
+// frame complete (DDP push, last E1.31/Art-Net universe or sync): append difference to previous frame
+void recordRealtimeFrame() {
+  if (rtRec.mode != RTREC_RECORD) return;
+  if (strip.getLengthTotal() != rtRec.pixels) { stopRtRecord(); return; } // LED setup changed
+  size_t frameLen = rtRec.pixels * 3;
+  if (rtRec.blockLen + frameLen * 3 / 2 + 16 > rtRec.blockSize) flushRtRecord();
+
+  uint32_t now = millis();
+  uint32_t dt  = rtRec.lastFrame ? now - rtRec.lastFrame : 0;
+  rtRec.lastFrame = now;
+
+  // encode payload after room for frame header, then move it behind the actual header
+  uint8_t *payload = rtRec.block + rtRec.blockLen + 10;
+  size_t len = 0, i = 0;
+  const uint8_t *cur = rtRec.frame, *prev = rtRec.prev;
+  while (rtRec.dirty && i < frameLen) {
+    size_t start = i;
+    while (i < frameLen && cur[i] == prev[i]) i++;
+    if (i == frameLen) break; // rest unchanged
+    size_t skip = i - start;
+    start = i;
+    // changed run, including short unchanged gaps
+    for (size_t gap = 0; i < frameLen; i++) {
+      if (cur[i] != prev[i]) gap = 0;
+      else if (++gap >= RTREC_MIN_SKIP) { i -= gap - 1; break; }
+    }
+    while (i > start && cur[i-1] == prev[i-1]) i--; // no unchanged bytes at end of run
+    len += putVarint(payload + len, skip);
+    len += putVarint(payload + len, i - start);
+    memcpy(payload + len, cur + start, i - start);
+    len += i - start;
+  }
+  uint8_t *hdr = rtRec.block + rtRec.blockLen;
+  size_t hlen = putVarint(hdr, dt);
+  hlen += putVarint(hdr + hlen, len);
+  memmove(hdr + hlen, payload, len);
+  rtRec.blockLen += hlen + len;
+  memcpy(rtRec.prev, rtRec.frame, frameLen);
+  rtRec.dirty = false;
+  rtRec.frames++;
+}
+
+// keeps read-ahead block filled; reads only when at least half a block is free so flash is accessed in large chunks
+static void fillRtPlayback() {
+  if (rtRec.eof) return;
+  size_t avail = rtRec.blockLen - rtRec.blockPos;
+  if (rtRec.blockSize - avail < RTREC_BLOCK/2) return;
+  memmove(rtRec.block, rtRec.block + rtRec.blockPos, avail);
+  rtRec.blockPos = 0;
+  rtRec.blockLen = avail;
+  size_t n = rtRec.file.read(rtRec.block + avail, rtRec.blockSize - avail);
+  rtRec.blockLen += n;
+  if (rtRec.blockLen < rtRec.blockSize) rtRec.eof = true;
+}
+
+// plays back frames at their recorded time (called from handleNotifications() before frames are shown)
+void handleRtPlayback() {
+  if (rtRec.mode != RTREC_PLAY) return;
+  fillRtPlayback();
+
+  const uint8_t *p = rtRec.block + rtRec.blockPos;
+  size_t avail = rtRec.blockLen - rtRec.blockPos;
+  uint32_t dt, len;
+  size_t n1 = getVarint(p, avail, dt);
+  size_t n2 = n1 ? getVarint(p + n1, avail - n1, len) : 0;
+  if ((!n2 && avail >= 10) || (n2 && n1 + n2 + len > rtRec.blockSize)) { // corrupt frame header (varints or frame exceeding the read-ahead block)
+    DEBUG_PRINTLN(F("Corrupt realtime recording, playback stopped."));
+    stopRtRecord();
+    return;
+  }
+  if (!n2 || n1 + n2 + len > avail) {
+    if (!rtRec.eof) return; // wait for data (should not happen, block holds a complete frame)
+    if (!rtRec.loop) { stopRtRecord(); return; }
+    rtRec.file.seek(RTREC_HEADER_SIZE); // restart from first frame (relative to black)
+    rtRec.blockLen = rtRec.blockPos = 0;
+    rtRec.eof = false;
+    memset(rtRec.frame, 0, rtRec.pixels * 3);
+    rtRec.lastFrame = millis();
+    rtRec.playTime = 0;
+    return;
+  }
+  if (millis() - rtRec.lastFrame < rtRec.playTime + dt) return; // not yet
+
+  rtRec.playTime += dt;
+  p += n1 + n2;
+  size_t frameLen = rtRec.pixels * 3, pos = 0;
+  for (const uint8_t *end = p + len; p < end && pos < frameLen; ) {
+    uint32_t skip, cnt;
+    size_t n = getVarint(p, end - p, skip);
+    size_t m = n ? getVarint(p + n, end - p - n, cnt) : 0;
+    if (!m || cnt > (size_t)(end - p) - n - m || pos + skip + cnt > frameLen) { // corrupt recording
+      DEBUG_PRINTLN(F("Corrupt realtime recording, playback stopped."));
+      stopRtRecord();
+      return;
+    }
+    p   += n + m;
+    pos += skip;
+    memcpy(rtRec.frame + pos, p, cnt);
+    p += cnt;
+    pos += cnt;
+  }
+  rtRec.blockPos += n1 + n2 + len;
+  rtRec.frames++;
+
+  // same path as a received DDP frame
+  realtimeLock(realtimeTimeoutMs, REALTIME_MODE_DDP);
+  if (!realtimeOverride || useMainSegmentOnly) setRealtimePixels(0, rtRec.frame, rtRec.pixels);
+  e131NewData = e131FrameEnd = true;
+}
+
+uint8_t getRtRecordMode() { return rtRec.mode; }
+uint32_t getRtRecordFrames() { return rtRec.frames; }
+
+#endif
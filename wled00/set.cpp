@@ -107,6 +107,7 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
       char aw[4] = "AW"; aw[2] = 48+s; aw[3] = 0; //auto white mode
       char wo[4] = "WO"; wo[2] = 48+s; wo[3] = 0; //channel swap
       char sp[4] = "SP"; sp[2] = 48+s; sp[3] = 0; //bus clock speed (DotStar & PWM)
+      char nd[4] = "ND"; nd[2] = 48+s; nd[3] = 0; //additional network destinations
       if (!request->hasArg(lp)) {
         DEBUG_PRINT(F("No data for "));
         DEBUG_PRINTLN(s);
@@ -155,6 +156,31 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
       // this may happen even before this loop is finished so we do "doInitBusses" after the loop
       if (busConfigs[s] != nullptr) delete busConfigs[s];
       busConfigs[s] = new BusConfig(type, pins, start, length, colorOrder | (channelSwap<<4), request->hasArg(cv), skip, awmode, freqHz, useGlobalLedBuffer);
+      if (IS_NETWORK(type & 0x7F) && request->hasArg(nd)) { // comma separated IP addresses
+        String list = request->arg(nd);
+        for (int p = 0; p < (int)list.length(); ) {
+          int e = list.indexOf(',', p);
+          if (e < 0) e = list.length();
+          IPAddress ip;
+          String item = list.substring(p, e);
+          item.trim();
+          if (ip.fromString(item)) {
+            uint8_t addr[4] = {ip[0], ip[1], ip[2], ip[3]};
+            busConfigs[s]->addDestination(addr);
+          }
+          p = e + 1;
+        }
+      } else if (IS_NETWORK(type & 0x7F)) { // field not submitted, keep destinations of the existing bus
+        Bus *bus = busses.getBus(s);
+        if (bus != nullptr && IS_NETWORK(bus->getType())) {
+          BusNetwork *nb = static_cast<BusNetwork*>(bus);
+          for (uint8_t i = 1; i < nb->getNumDestinations(); i++) {
+            IPAddress ip = nb->getDestination(i).ip;
+            uint8_t addr[4] = {ip[0], ip[1], ip[2], ip[3]};
+            busConfigs[s]->addDestination(addr);
+          }
+        }
+      }
       busesChanged = true;
     }
     //doInitBusses = busesChanged; // we will do that below to ensure all input data is processed
@@ -339,6 +365,7 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
     if (t > 99  && t <= 65000) realtimeTimeoutMs = t;
     arlsForceMaxBri = request->hasArg(F("FB"));
     arlsDisableGammaCorrection = request->hasArg(F("RG"));
+    realtimeInterpolate = request->hasArg(F("RI"));
     t = request->arg(F("WO")).toInt();
     if (t >= -255  && t <= 255) arlsOffset = t;
 
@@ -705,9 +732,8 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
         pO[l] = 'H'; p.height      = request->arg(pO).toInt();
         strip.panel.push_back(p);
       }
-      strip.setUpMatrix(); // will check limits
+      strip.setUpMatrix(); // will check limits (also applies default ledmap)
       strip.makeAutoSegments(true);
-      strip.deserializeMap();
     } else {
       Segment::maxWidth  = strip.getLengthTotal();
       Segment::maxHeight = 1;
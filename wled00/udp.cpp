@@ -149,6 +149,84 @@ void notify(byte callMode, bool followUp)
   notificationCount = followUp ? notificationCount + 1 : 0;
 }
 
+/*
+ * Realtime interpolation: DDP, E1.31 and Art-Net frames are collected in a receive buffer and the
+ * output is blended from the previously shown frame to the latest one over one (measured) source
+ * frame interval at the strip's target FPS. Adds at most RT_INTERP_MAX_INTERVAL ms of latency.
+ */
+static struct {
+  uint32_t *buf;      // 3 frames: from, to, receive
+  uint16_t  len;
+  uint16_t  interval; // ms, moving average of source frame interval (0 = show frames as received)
+  uint32_t  lastPush; // millis() of last complete frame
+  bool      done;     // latest frame fully shown
+} rtInterp = {nullptr, 0, 0, 0, true};
+
+static inline bool isInterpolatedMode(byte md) {
+  return md == REALTIME_MODE_E131 || md == REALTIME_MODE_ARTNET || md == REALTIME_MODE_DDP;
+}
+
+static void rtInterpFree() {
+  free(rtInterp.buf);
+  rtInterp.buf = nullptr;
+  rtInterp.len = rtInterp.interval = 0;
+  rtInterp.lastPush = 0;
+  rtInterp.done = true;
+}
+
+static void rtInterpBegin() {
+  uint16_t len = strip.getLengthTotal();
+  if (rtInterp.buf && rtInterp.len == len) return;
+  rtInterpFree();
+  rtInterp.buf = (uint32_t*) calloc(3 * len, sizeof(uint32_t)); // strip was cleared by realtimeLock()
+  if (rtInterp.buf) rtInterp.len = len;
+  else DEBUG_PRINTLN(F("Realtime interpolation disabled (no memory)."));
+}
+
+// 0-255 progress of blend from -> to
+static uint8_t rtInterpProgress(uint32_t now) {
+  uint32_t elapsed = now - rtInterp.lastPush;
+  if (!rtInterp.interval || elapsed >= rtInterp.interval) return 255;
+  return elapsed * 255 / rtInterp.interval;
+}
+
+static void writeRealtimePixel(uint16_t pix, uint32_t c) {
+  if (useMainSegmentOnly) {
+    Segment &seg = strip.getMainSegment();
+    if (pix<seg.length()) seg.setPixelColor(pix, c);
+  } else {
+    strip.setPixelColor(pix, c);
+  }
+}
+
+// complete frame received: current blend becomes start point, received frame the target
+static void pushRealtimeFrame() {
+  uint32_t now = millis();
+  uint32_t dt  = now - rtInterp.lastPush;
+  uint8_t  t   = rtInterpProgress(now);
+  if (!rtInterp.lastPush || dt >= RT_INTERP_MAX_INTERVAL) rtInterp.interval = 0; // first frame or source paused
+  else if (dt >= RT_INTERP_MIN_INTERVAL) rtInterp.interval = rtInterp.interval ? (rtInterp.interval * 3 + dt) >> 2 : dt;
+  uint32_t *from = rtInterp.buf, *to = from + rtInterp.len, *recv = to + rtInterp.len;
+  for (size_t i = 0; i < rtInterp.len; i++) {
+    from[i] = t < 255 ? color_blend(from[i], to[i], t) : to[i];
+    to[i]   = recv[i];
+  }
+  rtInterp.lastPush = now;
+  rtInterp.done = false;
+}
+
+static void handleRealtimeInterpolation() {
+  if (!rtInterp.buf) return;
+  if (!realtimeInterpolate || !isInterpolatedMode(realtimeMode)) { rtInterpFree(); return; }
+  if (rtInterp.done || millis() - strip.getLastShow() < strip.getFrameTime()) return;
+  if (realtimeOverride && !useMainSegmentOnly) return;
+  uint8_t t = rtInterpProgress(millis());
+  const uint32_t *from = rtInterp.buf, *to = from + rtInterp.len;
+  for (size_t i = 0; i < rtInterp.len; i++) writeRealtimePixel(i, t < 255 ? color_blend(from[i], to[i], t) : to[i]);
+  rtInterp.done = t == 255;
+  strip.show();
+}
+
 void realtimeLock(uint32_t timeoutMs, byte md)
 {
   if (!realtimeMode && !realtimeOverride) {
@@ -180,6 +258,7 @@ void realtimeLock(uint32_t timeoutMs, byte md)
     realtimeTimeout = (timeoutMs == 255001 || timeoutMs == 65000) ? UINT32_MAX : millis() + timeoutMs;
   }
   realtimeMode = md;
+  if (realtimeInterpolate && isInterpolatedMode(md)) rtInterpBegin();
 
   if (realtimeOverride) return;
   if (arlsForceMaxBri) strip.setBrightness(scaledBri(255), true);
@@ -193,6 +272,8 @@ void exitRealtime() {
   realtimeTimeout = 0; // cancel realtime mode immediately
   realtimeMode = REALTIME_MODE_INACTIVE; // inform UI immediately
   realtimeIP[0] = 0;
+  rtInterpFree();
+  resetE131FrameSync();
   if (useMainSegmentOnly) { // unfreeze live segment again
     strip.getMainSegment().freeze = false;
   } else {
@@ -212,6 +293,70 @@ void sendTPM2Ack() {
 }
 
 
+// receiver state of WLED delta protocol (of the sender packets were last received from)
+static struct {
+  IPAddress src;    // sender
+  uint8_t  seq;     // frame sequence expected next
+  uint8_t  idx;     // packet index expected next
+  uint8_t  keySeq;  // sequence of last keyframe whose first packet was received
+  bool     synced;  // no packet missed since last keyframe
+  bool     keyReq;  // keyframe requested from sender
+  uint32_t lost;    // frames lost (detected by sequence gaps)
+} rtDelta = {IPAddress(), 0, 0, 0, false, false, 0};
+
+static void handleDeltaPacket(const uint8_t *p, size_t len)
+{
+  uint8_t flags = p[2], seq = p[3], idx = p[4];
+
+  bool newSender = rtDelta.src != realtimeIP;
+  if (newSender) {
+    rtDelta.src    = realtimeIP;
+    rtDelta.synced = rtDelta.keyReq = false;
+  }
+  bool inOrder = !newSender && seq == rtDelta.seq && idx == rtDelta.idx;
+
+  // a missing packet leaves stale pixels until the next keyframe: ask the sender for one right away (once per loss)
+  // keyframe packets are checked too, a keyframe whose first packet was lost does not resync
+  if ((flags & UDP_DELTA_KEY) && idx == 0) {
+    rtDelta.synced = true;
+    rtDelta.keyReq = false;
+    rtDelta.keySeq = seq;
+  } else if (!inOrder || ((flags & UDP_DELTA_KEY) && seq != rtDelta.keySeq)) {
+    if (rtDelta.synced) rtDelta.lost++;
+    if (!rtDelta.keyReq) {
+      uint8_t req[UDP_DELTA_HEADER] = {UDP_DELTA_PROTOCOL, 0, UDP_DELTA_KEYREQ, seq, idx};
+      notifierUdp.beginPacket(realtimeIP, udpPort); // sender listens on the WLED notifier port
+      notifierUdp.write(req, sizeof(req));
+      notifierUdp.endPacket();
+      rtDelta.keyReq = true;
+    }
+    rtDelta.synced = false;
+  }
+  if (flags & UDP_DELTA_PUSH) { rtDelta.seq = seq + 1; rtDelta.idx = 0; }
+  else                        { rtDelta.seq = seq;     rtDelta.idx = idx + 1; }
+
+  if (p[1] == 0) { realtimeTimeout = 0; return; }
+  realtimeLock(p[1]*1000 +1, REALTIME_MODE_UDP);
+  if (realtimeOverride && !(realtimeMode && useMainSegmentOnly)) return;
+
+  const uint8_t ch = (flags & UDP_DELTA_RGBW) ? 4 : 3;
+  uint16_t totalLen = strip.getLengthTotal();
+  for (size_t i = UDP_DELTA_HEADER; i + 3 <= len; ) {
+    uint16_t id  = (p[i] << 8) | p[i+1];
+    uint8_t  cnt = p[i+2];
+    i += 3;
+    if (i + cnt*ch > len) break; // truncated span
+    for (uint8_t n = 0; n < cnt && id < totalLen; n++, id++) {
+      const uint8_t *c = p + i + n*ch;
+      setRealtimePixel(id, c[0], c[1], c[2], ch == 4 ? c[3] : 0);
+    }
+    i += cnt*ch;
+  }
+  if (flags & UDP_DELTA_PUSH) strip.show();
+}
+
+uint32_t getDeltaLostFrames() { return rtDelta.lost; }
+
 void handleNotifications()
 {
   IPAddress localIP;
@@ -221,14 +366,28 @@ void handleNotifications()
     notify(notificationSentCallMode,true);
   }
 
-  if (e131NewData && millis() - strip.getLastShow() > 15)
+  strip.lockRender(); // network I/O below is done without the render lock, packets are applied with it
+  #ifdef WLED_ENABLE_RT_RECORD
+  handleRtPlayback(); // recorded frames take the same path as received ones
+  #endif
+  bool frameEnd = e131FrameEnd; // E1.31/Art-Net set e131NewData for every universe
+  e131FrameEnd = false;
+  #ifdef WLED_ENABLE_RT_RECORD
+  if (frameEnd) recordRealtimeFrame();
+  #endif
+  if (rtInterp.buf && isInterpolatedMode(realtimeMode)) {
+    if (frameEnd) pushRealtimeFrame(); // only complete frames, shown by handleRealtimeInterpolation()
+    e131NewData = false;
+  } else if (e131NewData && millis() - strip.getLastShow() > 15)
   {
     e131NewData = false;
     strip.show();
   }
+  handleRealtimeInterpolation();
 
   //unlock strip when realtime UDP times out
   if (realtimeMode && millis() > realtimeTimeout) exitRealtime();
+  strip.unlockRender();
 
   //receive UDP notifications
   if (!udpConnected) return;
@@ -250,6 +409,7 @@ void handleNotifications()
       DEBUG_PRINTLN(rgbUdp.remoteIP());
       uint8_t lbuf[packetSize];
       rgbUdp.read(lbuf, packetSize);
+      RenderLockGuard lock;
       realtimeLock(realtimeTimeoutMs, REALTIME_MODE_HYPERION);
       if (realtimeOverride && !(realtimeMode && useMainSegmentOnly)) return;
       uint16_t id = 0;
@@ -275,6 +435,7 @@ void handleNotifications()
   uint16_t len;
   if (isSupp) len = notifier2Udp.read(udpIn, packetSize);
   else        len =  notifierUdp.read(udpIn, packetSize);
+  RenderLockGuard lock; // applying the packet changes segments or pixels
 
   // WLED nodes info notifications
   if (isSupp && udpIn[0] == 255 && udpIn[1] == 1 && len >= 40) {
@@ -469,6 +630,16 @@ void handleNotifications()
     return;
   }
 
+  //WLED delta: frame lost on a receiver we send to (only busses sending to it send a keyframe)
+  if (udpIn[0] == UDP_DELTA_PROTOCOL && packetSize == UDP_DELTA_HEADER && (udpIn[2] & UDP_DELTA_KEYREQ)) {
+    IPAddress from = isSupp ? notifier2Udp.remoteIP() : notifierUdp.remoteIP();
+    for (uint8_t b = 0; b < busses.getNumBusses(); b++) {
+      Bus *bus = busses.getBus(b);
+      if (bus && bus->getType() == TYPE_NET_DELTA_RGB) static_cast<BusNetwork*>(bus)->requestKeyframe(from);
+    }
+    return;
+  }
+
   if (!receiveDirect) return;
 
   //TPM2.NET
@@ -574,6 +745,14 @@ void handleNotifications()
     return;
   }
 
+  //WLED delta: changed spans sent by a TYPE_NET_DELTA_RGB bus
+  if (udpIn[0] == UDP_DELTA_PROTOCOL && packetSize >= UDP_DELTA_HEADER)
+  {
+    realtimeIP = (isSupp) ? notifier2Udp.remoteIP() : notifierUdp.remoteIP();
+    handleDeltaPacket(udpIn, packetSize);
+    return;
+  }
+
   // API over UDP
   udpIn[packetSize] = '\0';
 
@@ -594,6 +773,9 @@ void handleNotifications()
 
 void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w)
 {
+  #ifdef WLED_ENABLE_RT_RECORD
+  if (isInterpolatedMode(realtimeMode)) recordRealtimePixel(i, r, g, b);
+  #endif
   uint16_t pix = i + arlsOffset;
   if (pix < strip.getLengthTotal()) {
     if (!arlsDisableGammaCorrection && gammaCorrectCol) {
@@ -602,12 +784,28 @@ void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w)
       b = gamma8(b);
       w = gamma8(w);
     }
-    if (useMainSegmentOnly) {
-      Segment &seg = strip.getMainSegment();
-      if (pix<seg.length()) seg.setPixelColor(pix, r, g, b, w);
-    } else {
-      strip.setPixelColor(pix, r, g, b, w);
+    if (rtInterp.buf && isInterpolatedMode(realtimeMode) && pix < rtInterp.len) {
+      rtInterp.buf[2*rtInterp.len + pix] = RGBW32(r, g, b, w); // receive buffer, output is blended
+      return;
     }
+    writeRealtimePixel(pix, RGBW32(r, g, b, w));
+  }
+}
+
+// writes a span of count RGB pixels (3 bytes each, as received) starting at realtime index i
+void setRealtimePixels(uint16_t i, const byte *rgb, uint16_t count)
+{
+  int pix = i + arlsOffset;
+  int end = MIN(pix + count, (int)strip.getLengthTotal());
+  if (pix < 0) { rgb -= pix*3; pix = 0; }
+  bool gc = !arlsDisableGammaCorrection && gammaCorrectCol;
+  bool interp = rtInterp.buf && isInterpolatedMode(realtimeMode);
+  Segment &seg = strip.getMainSegment();
+  for (; pix < end; pix++, rgb += 3) {
+    uint32_t c = gc ? RGBW32(gamma8(rgb[0]), gamma8(rgb[1]), gamma8(rgb[2]), 0) : RGBW32(rgb[0], rgb[1], rgb[2], 0);
+    if (interp) { if (pix < rtInterp.len) rtInterp.buf[2*rtInterp.len + pix] = c; }
+    else if (useMainSegmentOnly) { if (pix < seg.length()) seg.setPixelColor(pix, c); }
+    else strip.setPixelColor(pix, c);
   }
 }
 
@@ -712,22 +910,55 @@ void sendSysInfoUDP()
 #define DDP_CHANNELS_PER_PACKET 1440 // 480 leds
 
 //
-// Send real time UDP updates to the specified client
+// Send real time UDP updates to the destinations of a network bus
 //
-// type   - protocol type (0=DDP, 1=E1.31, 2=ArtNet)
-// client - the IP address to send to
-// length - the number of pixels
-// buffer - a buffer of at least length*4 bytes long
-// isRGBW - true if the buffer contains 4 components per pixel
+// type     - protocol type (0=DDP, 1=E1.31, 2=ArtNet)
+// dest     - the IP addresses to send to (unicast or multicast), send statistics are updated
+// numDest  - number of destinations
+// length   - the number of pixels
+// buffer   - a buffer of at least length*4 bytes long
+// isRGBW   - true if the buffer contains 4 components per pixel
+//
+// every packet is built once and then sent to each destination
 
 static       size_t sequenceNumber = 0; // this needs to be shared across all outputs
 static const size_t ART_NET_HEADER_SIZE = 12;
 static const byte   ART_NET_HEADER[] PROGMEM = {0x41,0x72,0x74,0x2d,0x4e,0x65,0x74,0x00,0x00,0x50,0x00,0x0e};
 
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW)  {
-  if (!(apActive || interfacesInited) || !client[0] || !length) return 1;  // network not initialised or dummy/unset IP address  031522 ajn added check for ap
+// sends a prepared packet to all destinations, returns number of destinations that failed
+uint8_t realtimeSendPacket(NetDestination *dest, uint8_t numDest, uint16_t port, const uint8_t *buffer, size_t len) {
+  if (!(apActive || interfacesInited) || !len) return numDest; // network not initialised
+  WiFiUDP sendUdp;
+  uint8_t failed = 0;
+  for (uint8_t d = 0; d < numDest; d++) {
+    if (!dest[d].ip[0]) continue; // dummy/unset IP address
+    uint32_t start = micros();
+    #ifdef ESP8266
+    bool ok = (dest[d].ip[0] & 0xF0) == 0xE0 ? sendUdp.beginPacketMulticast(dest[d].ip, port, Network.localIP()) : sendUdp.beginPacket(dest[d].ip, port);
+    #else
+    bool ok = sendUdp.beginPacket(dest[d].ip, port);
+    #endif
+    if (ok) {
+      sendUdp.write(buffer, len);
+      ok = sendUdp.endPacket();
+    }
+    uint16_t us = MIN(micros() - start, 65535UL);
+    dest[d].sendTime = dest[d].packets ? (dest[d].sendTime * 7 + us) >> 3 : us; // running average
+    dest[d].packets++;
+    if (!ok) {
+      DEBUG_PRINTF("UDP send to %s failed\n", dest[d].ip.toString().c_str());
+      dest[d].failed++;
+      failed++;
+    }
+  }
+  return failed;
+}
+
+uint8_t realtimeBroadcast(uint8_t type, NetDestination *dest, uint8_t numDest, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW)  {
+  if (!(apActive || interfacesInited) || !numDest || !length) return 1;  // network not initialised  031522 ajn added check for ap
 
-  WiFiUDP ddpUdp;
+  static uint8_t packet[DDP_HEADER_LEN + DDP_CHANNELS_PER_PACKET];
+  uint8_t failed = 0;
 
   switch (type) {
     case 0: // DDP
@@ -744,11 +975,6 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
       for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
         if (sequenceNumber > 15) sequenceNumber = 0;
 
-        if (!ddpUdp.beginPacket(client, DDP_DEFAULT_PORT)) {  // port defined in ESPAsyncE131.h
-          DEBUG_PRINTLN(F("WiFiUDP.beginPacket returned an error"));
-          return 1; // problem
-        }
-
         // the amount of data is AFTER the header in the current packet
         size_t packetSize = DDP_CHANNELS_PER_PACKET;
 
@@ -763,32 +989,23 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
         }
 
         // write the header
-        /*0*/ddpUdp.write(flags);
-        /*1*/ddpUdp.write(sequenceNumber++ & 0x0F); // sequence may be unnecessary unless we are sending twice (as requested in Sync settings)
-        /*2*/ddpUdp.write(isRGBW ?  DDP_TYPE_RGBW32 : DDP_TYPE_RGB24);
-        /*3*/ddpUdp.write(DDP_ID_DISPLAY);
+        /*0*/packet[0] = flags;
+        /*1*/packet[1] = sequenceNumber++ & 0x0F; // sequence may be unnecessary unless we are sending twice (as requested in Sync settings)
+        /*2*/packet[2] = isRGBW ?  DDP_TYPE_RGBW32 : DDP_TYPE_RGB24;
+        /*3*/packet[3] = DDP_ID_DISPLAY;
         // data offset in bytes, 32-bit number, MSB first
-        /*4*/ddpUdp.write(0xFF & (channel >> 24));
-        /*5*/ddpUdp.write(0xFF & (channel >> 16));
-        /*6*/ddpUdp.write(0xFF & (channel >>  8));
-        /*7*/ddpUdp.write(0xFF & (channel      ));
+        /*4*/packet[4] = 0xFF & (channel >> 24);
+        /*5*/packet[5] = 0xFF & (channel >> 16);
+        /*6*/packet[6] = 0xFF & (channel >>  8);
+        /*7*/packet[7] = 0xFF & (channel      );
         // data length in bytes, 16-bit number, MSB first
-        /*8*/ddpUdp.write(0xFF & (packetSize >> 8));
-        /*9*/ddpUdp.write(0xFF & (packetSize     ));
-
-        // write the colors, the write write(const uint8_t *buffer, size_t size)
-        // function is just a loop internally too
-        for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
-          if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
-        }
+        /*8*/packet[8] = 0xFF & (packetSize >> 8);
+        /*9*/packet[9] = 0xFF & (packetSize     );
 
-        if (!ddpUdp.endPacket()) {
-          DEBUG_PRINTLN(F("WiFiUDP.endPacket returned an error"));
-          return 1; // problem
-        }
+        // write the colors (R,G,B[,W])
+        for (size_t i = 0; i < packetSize; i++) packet[DDP_HEADER_LEN + i] = scale8(buffer[bufferOffset++], bri);
+
+        failed |= realtimeSendPacket(dest, numDest, DDP_DEFAULT_PORT, packet, DDP_HEADER_LEN + packetSize);  // port defined in ESPAsyncE131.h
 
         channel += packetSize;
       }
@@ -814,11 +1031,6 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
 
         if (sequenceNumber > 255) sequenceNumber = 0;
 
-        if (!ddpUdp.beginPacket(client, ARTNET_DEFAULT_PORT)) {
-          DEBUG_PRINTLN(F("Art-Net WiFiUDP.beginPacket returned an error"));
-          return 1; // borked
-        }
-
         size_t packetSize = ARTNET_CHANNELS_PER_PACKET;
 
         if (currentPacket == (packetCount - 1U)) {
@@ -828,30 +1040,20 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
           }
         }
 
-        byte header_buffer[ART_NET_HEADER_SIZE];
-        memcpy_P(header_buffer, ART_NET_HEADER, ART_NET_HEADER_SIZE);
-        ddpUdp.write(header_buffer, ART_NET_HEADER_SIZE); // This doesn't change. Hard coded ID, OpCode, and protocol version.
-        ddpUdp.write(sequenceNumber & 0xFF); // sequence number. 1..255
-        ddpUdp.write(0x00); // physical - more an FYI, not really used for anything. 0..3
-        ddpUdp.write((currentPacket) & 0xFF); // Universe LSB. 1 full packet == 1 full universe, so just use current packet number.
-        ddpUdp.write(0x00); // Universe MSB, unused.
-        ddpUdp.write(0xFF & (packetSize >> 8)); // 16-bit length of channel data, MSB
-        ddpUdp.write(0xFF & (packetSize     )); // 16-bit length of channel data, LSB
-
-        for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
-          if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
-        }
+        memcpy_P(packet, ART_NET_HEADER, ART_NET_HEADER_SIZE); // This doesn't change. Hard coded ID, OpCode, and protocol version.
+        packet[12] = sequenceNumber & 0xFF; // sequence number. 1..255
+        packet[13] = 0x00; // physical - more an FYI, not really used for anything. 0..3
+        packet[14] = (currentPacket) & 0xFF; // Universe LSB. 1 full packet == 1 full universe, so just use current packet number.
+        packet[15] = 0x00; // Universe MSB, unused.
+        packet[16] = 0xFF & (packetSize >> 8); // 16-bit length of channel data, MSB
+        packet[17] = 0xFF & (packetSize     ); // 16-bit length of channel data, LSB
 
-        if (!ddpUdp.endPacket()) {
-          DEBUG_PRINTLN(F("Art-Net WiFiUDP.endPacket returned an error"));
-          return 1; // borked
-        }
+        for (size_t i = 0; i < packetSize; i++) packet[ART_NET_HEADER_SIZE + 6 + i] = scale8(buffer[bufferOffset++], bri);
+
+        failed |= realtimeSendPacket(dest, numDest, ARTNET_DEFAULT_PORT, packet, ART_NET_HEADER_SIZE + 6 + packetSize);
         channel += packetSize;
       }
     } break;
   }
-  return 0;
+  return failed ? 1 : 0;
 }
@@ -34,6 +34,8 @@ bool UsermodManager::readFromConfig(JsonObject& obj)    {
   }
   return allComplete;
 }
+// single usermod variant (used when reading cfg.json section by section)
+bool UsermodManager::readFromConfig(JsonObject& obj, byte mod) { return mod < numMods ? ums[mod]->readFromConfig(obj) : true; }
 void UsermodManager::onMqttConnect(bool sessionPresent) { for (byte i = 0; i < numMods; i++) ums[i]->onMqttConnect(sessionPresent); }
 bool UsermodManager::onMqttMessage(char* topic, char* payload) {
   for (byte i = 0; i < numMods; i++) if (ums[i]->onMqttMessage(topic, payload)) return true;
@@ -237,17 +237,9 @@ uint8_t extractModeName(uint8_t mode, const char *src, char *dest, uint8_t maxLe
 {
   if (src == JSON_mode_names || src == nullptr) {
     if (mode < strip.getModeCount()) {
-      char lineBuffer[256];
-      //strcpy_P(lineBuffer, (const char*)pgm_read_dword(&(WS2812FX::_modeData[mode])));
-      strncpy_P(lineBuffer, strip.getModeData(mode), sizeof(lineBuffer)/sizeof(char)-1);
-      lineBuffer[sizeof(lineBuffer)/sizeof(char)-1] = '\0'; // terminate string
-      size_t len = strlen(lineBuffer);
-      size_t j = 0;
-      for (; j < maxLen && j < len; j++) {
-        if (lineBuffer[j] == '\0' || lineBuffer[j] == '@') break;
-        dest[j] = lineBuffer[j];
-      }
-      dest[j] = 0; // terminate string
+      size_t len = MIN((size_t)strip.getModeMeta(mode).nameLen, (size_t)maxLen); // name length is known from metadata
+      strncpy_P(dest, strip.getModeData(mode), len);
+      dest[len] = 0; // terminate string
       return strlen(dest);
     } else return 0;
   }
@@ -295,54 +287,58 @@ uint8_t extractModeSlider(uint8_t mode, uint8_t slider, char *dest, uint8_t maxL
   dest[0] = '\0'; // start by clearing buffer
 
   if (mode < strip.getModeCount()) {
-    String lineBuffer = FPSTR(strip.getModeData(mode));
-    if (lineBuffer.length() > 0) {
-      int16_t start = lineBuffer.indexOf('@');
-      int16_t stop  = lineBuffer.indexOf(';', start);
-      if (start>0 && stop>0) {
-        String names = lineBuffer.substring(start, stop); // include @
-        int16_t nameBegin = 1, nameEnd, nameDefault;
+    const char *modeData = strip.getModeData(mode);
+    const mode_meta_t &meta = strip.getModeMeta(mode);
+    if (pgm_read_byte(modeData) != '\0') {
+      if ((meta.flags & FX_META_DATA) && meta.nameLen && meta.sliderEnd) {
         if (slider < 10) {
-          for (size_t i=0; i<=slider; i++) {
-            const char *tmpstr;
-            dest[0] = '\0'; //clear dest buffer
-            if (nameBegin == 0) break; // there are no more names
-            nameEnd = names.indexOf(',', nameBegin);
-            if (i == slider) {
-              nameDefault = names.indexOf('=', nameBegin); // find default value
-              if (nameDefault > 0 && var && ((nameEnd>0 && nameDefault<nameEnd) || nameEnd<0)) {
-                *var = (uint8_t)atoi(names.substring(nameDefault+1).c_str());
-              }
-              if (names.charAt(nameBegin) == '!') {
-                switch (slider) {
-                  case  0: tmpstr = PSTR("FX Speed");     break;
-                  case  1: tmpstr = PSTR("FX Intensity"); break;
-                  case  2: tmpstr = PSTR("FX Custom 1");  break;
-                  case  3: tmpstr = PSTR("FX Custom 2");  break;
-                  case  4: tmpstr = PSTR("FX Custom 3");  break;
-                  default: tmpstr = PSTR("FX Custom");    break;
-                }
-                strncpy_P(dest, tmpstr, maxLen); // copy the name into buffer (replacing previous)
-                dest[maxLen-1] = '\0';
-              } else {
-                if (nameEnd<0) tmpstr = names.substring(nameBegin).c_str(); // did not find ",", last name?
-                else           tmpstr = names.substring(nameBegin, nameEnd).c_str();
-                strlcpy(dest, tmpstr, maxLen); // copy the name into buffer (replacing previous)
+          // copy only slider names section (between @ and first ;) using offsets from metadata
+          size_t namesLen = meta.sliderEnd - meta.nameLen - 1;
+          char names[namesLen+1];
+          strncpy_P(names, modeData + meta.nameLen + 1, namesLen);
+          names[namesLen] = '\0';
+          char *nameBegin = names;
+          for (size_t i=0; i<slider && nameBegin; i++) {
+            nameBegin = strchr(nameBegin, ',');           // skip to next name
+            if (nameBegin) nameBegin++;
+          }
+          if (nameBegin) {
+            char *nameEnd = strchr(nameBegin, ',');
+            if (nameEnd) *nameEnd = '\0';
+            char *nameDefault = strchr(nameBegin, '=');  // find default value
+            if (nameDefault && var) *var = (uint8_t)atoi(nameDefault+1);
+            if (nameBegin[0] == '!') {
+              const char *tmpstr;
+              switch (slider) {
+                case  0: tmpstr = PSTR("FX Speed");     break;
+                case  1: tmpstr = PSTR("FX Intensity"); break;
+                case  2: tmpstr = PSTR("FX Custom 1");  break;
+                case  3: tmpstr = PSTR("FX Custom 2");  break;
+                case  4: tmpstr = PSTR("FX Custom 3");  break;
+                default: tmpstr = PSTR("FX Custom");    break;
               }
+              strncpy_P(dest, tmpstr, maxLen); // copy the name into buffer (replacing previous)
+              dest[maxLen-1] = '\0';
+            } else {
+              strlcpy(dest, nameBegin, maxLen); // copy the name into buffer
             }
-            nameBegin = nameEnd+1; // next name (if "," is not found it will be 0)
-          } // next slider
+          }
         } else if (slider == 255) {
           // palette
           strlcpy(dest, "pal", maxLen);
-          names = lineBuffer.substring(stop+1); // stop has index of color slot names
-          nameBegin = names.indexOf(';'); // look for palette
-          if (nameBegin >= 0) {
-            nameEnd = names.indexOf(';', nameBegin+1);
-            if (!isdigit(names[nameBegin+1])) nameBegin = names.indexOf('=', nameBegin+1); // look for default value
-            if (nameEnd >= 0 && nameBegin > nameEnd) nameBegin = -1;
-            if (nameBegin >= 0 && var) {
-              *var = (uint8_t)atoi(names.substring(nameBegin+1).c_str());
+          if (meta.paletteOfs && var) {
+            const char *palPtr = modeData + meta.paletteOfs;
+            char c = pgm_read_byte(palPtr);
+            if (!isdigit(c)) {
+              // look for default value (e.g. "!=5") before end of palette section
+              while (c != '\0' && c != ';' && c != '=') c = pgm_read_byte(++palPtr);
+              if (c != '=') palPtr = nullptr;
+            } else palPtr--; // atoi() below skips one character
+            if (palPtr) {
+              char value[4];
+              strncpy_P(value, palPtr+1, sizeof(value)-1);
+              value[sizeof(value)-1] = '\0';
+              *var = (uint8_t)atoi(value);
             }
           }
         }
@@ -365,9 +361,13 @@ uint8_t extractModeSlider(uint8_t mode, uint8_t slider, char *dest, uint8_t maxL
 
 
 // extracts mode parameter defaults from last section of mode data (e.g. "Juggle@!,Trail;!,!,;!;sx=16,ix=240,1d")
+// known parameters are parsed once at boot (see WS2812FX::parseModeMeta())
 int16_t extractModeDefaults(uint8_t mode, const char *segVar)
 {
   if (mode < strip.getModeCount()) {
+    int8_t key = WS2812FX::getModeDefaultKey(segVar, strlen(segVar));
+    if (key >= 0) return strip.getModeDefault(mode, key);
+    // parameter unknown to metadata (e.g. used by usermod), scan effect data
     char lineBuffer[256];
     strncpy_P(lineBuffer, strip.getModeData(mode), sizeof(lineBuffer)/sizeof(char)-1);
     lineBuffer[sizeof(lineBuffer)/sizeof(char)-1] = '\0'; // terminate string
@@ -527,13 +527,15 @@ um_data_t* simulateSound(uint8_t simulationId)
 }
 
 
-// enumerate all ledmapX.json files on FS and extract ledmap names if existing
+// enumerate all ledmapX.json (or ledmapX.bin) files on FS and extract ledmap names if existing
 void enumerateLedmaps() {
   ledMaps = 1;
   for (size_t i=1; i<WLED_MAX_LEDMAPS; i++) {
     char fileName[33];
     sprintf_P(fileName, PSTR("/ledmap%d.json"), i);
-    bool isFile = WLED_FS.exists(fileName);
+    bool isJson = WLED_FS.exists(fileName);
+    strcpy_P(strrchr(fileName, '.'), PSTR(".bin"));
+    bool isFile = isJson || WLED_FS.exists(fileName);
 
     #ifndef ESP8266
     if (ledmapNames[i-1]) { //clear old name
@@ -546,8 +548,11 @@ void enumerateLedmaps() {
       ledMaps |= 1 << i;
 
       #ifndef ESP8266
-      if (requestJSONBufferLock(21)) {
-        if (readObjectFromFile(fileName, nullptr, &doc)) {
+      if (isJson && requestJSONBufferLock(21)) {
+        StaticJsonDocument<32> filter;  // only extract name, map array may not fit into JSON buffer
+        filter["n"] = true;
+        sprintf_P(fileName, PSTR("/ledmap%d.json"), i);
+        if (readObjectFromFile(fileName, nullptr, &doc, &filter)) {
           size_t len = 0;
           if (!doc["n"].isNull()) {
             // name field exists
@@ -558,16 +563,16 @@ void enumerateLedmaps() {
               if (ledmapNames[i-1]) strlcpy(ledmapNames[i-1], name, 33);
             }
           }
-          if (!ledmapNames[i-1]) {
-            char tmp[33];
-            snprintf_P(tmp, 32, PSTR("ledmap%d.json"), i);
-            len = strlen(tmp);
-            ledmapNames[i-1] = new char[len+1];
-            if (ledmapNames[i-1]) strlcpy(ledmapNames[i-1], tmp, 33);
-          }
         }
         releaseJSONBufferLock();
       }
+      if (!ledmapNames[i-1]) {
+        char tmp[33];
+        snprintf_P(tmp, 32, isJson ? PSTR("ledmap%d.json") : PSTR("ledmap%d.bin"), i);
+        size_t len = strlen(tmp);
+        ledmapNames[i-1] = new char[len+1];
+        if (ledmapNames[i-1]) strlcpy(ledmapNames[i-1], tmp, 33);
+      }
       #endif
     }
 
@@ -49,17 +49,24 @@ void WLED::loop()
   unsigned long        stripMillis;
   #endif
 
+  // handlers that change segments or pixels hold the render lock (render task runs in between),
+  // network, file and preset I/O is done without it (see handleNotifications(), handlePresets())
   handleTime();
   #ifndef WLED_DISABLE_INFRARED
+  strip.lockRender();
   handleIR();        // 2nd call to function needed for ESP32 to return valid results -- should be good for ESP8266, too
+  strip.unlockRender();
   #endif
   handleConnection();
+  strip.lockRender();
   #ifndef WLED_DISABLE_ESPNOW
   handleRemote();
   #endif
   handleSerial();
+  strip.unlockRender();
   handleImprovWifiScan();
   handleNotifications();
+  strip.lockRender();
   handleTransitions();
 #ifdef WLED_ENABLE_DMX
   handleDMX();
@@ -75,8 +82,10 @@ void WLED::loop()
   avgUsermodMillis += usermodMillis;
   if (usermodMillis > maxUsermodMillis) maxUsermodMillis = usermodMillis;
   #endif
+  strip.unlockRender();
 
   yield();
+  strip.lockRender();
   handleIO();
   #ifndef WLED_DISABLE_INFRARED
   handleIR();
@@ -84,6 +93,7 @@ void WLED::loop()
   #ifndef WLED_DISABLE_ALEXA
   handleAlexa();
   #endif
+  strip.unlockRender();
 
   if (doCloseFile) {
     closeFile();
@@ -99,25 +109,42 @@ void WLED::loop()
     #ifndef WLED_DISABLE_OTA
     if (WLED_CONNECTED && aOtaEnabled && !otaLock && correctPIN) ArduinoOTA.handle();
     #endif
+    strip.lockRender();
     handleNightlight();
     handlePlaylist();
+    strip.unlockRender();
     yield();
 
     #ifndef WLED_DISABLE_HUESYNC
+    strip.lockRender();
     handleHue();
+    strip.unlockRender();
     yield();
     #endif
 
-    handlePresets();
+    handlePresets(); // takes render lock itself
     yield();
 
-    if (!offMode || strip.isOffRefreshRequired())
+    strip.lockRender();
+    bool replaying = false;
+    #ifdef WLED_ENABLE_FX_REPLAY
+    replaying = handleFxReplay(); // replay calls service() itself with a fixed clock
+    #endif
+
+    if ((!offMode || strip.isOffRefreshRequired()) && !strip.isPipelined() && !replaying) // pipelined effects run in render task
       strip.service();
     #ifdef ESP8266
     else if (!noWifiSleep)
       delay(1); //required to make sure ESP enters modem sleep (see #1184)
     #endif
+    strip.unlockRender();
+    if (!bootTime[BOOT_PHASE_LIGHT]) handleBootTime();
   }
+  #ifdef WLED_ENABLE_DOUBLE_BUFFER
+  strip.lockRender();
+  strip.presentFrame(); // send back buffer as soon as busses are idle
+  strip.unlockRender();
+  #endif
   #ifdef WLED_DEBUG
   stripMillis = millis() - stripMillis;
   avgStripMillis += stripMillis;
@@ -156,7 +183,16 @@ void WLED::loop()
 
   //LED settings have been saved, re-init busses
   //This code block causes severe FPS drop on ESP32 with the original "if (busConfigs[0] != nullptr)" conditional. Investigate!
+  #ifdef WLED_ENABLE_RENDER_TASK
+  bool restartPipeline = (doInitBusses || loadLedmap >= 0) && strip.isPipelined();
+  if (restartPipeline) strip.stopPipeline(); // busses and LED count may change
+  #endif
+  #ifdef WLED_ENABLE_DOUBLE_BUFFER
+  bool restartBuffer = doInitBusses && strip.isDoubleBuffered();
+  if (restartBuffer) strip.stopDoubleBuffer(); // LED count may change
+  #endif
   if (doInitBusses) {
+    RenderLockGuard lock;
     doInitBusses = false;
     DEBUG_PRINTLN(F("Re-init busses."));
     bool aligned = strip.checkSegmentAlignment(); //see if old segments match old bus(ses)
@@ -181,9 +217,16 @@ void WLED::loop()
     doSerializeConfig = true;
   }
   if (loadLedmap >= 0) {
+    RenderLockGuard lock;
     if (!strip.deserializeMap(loadLedmap) && strip.isMatrix && loadLedmap == 0) strip.setUpMatrix();
     loadLedmap = -1;
   }
+  #ifdef WLED_ENABLE_RENDER_TASK
+  if (restartPipeline) strip.startPipeline();
+  #endif
+  #ifdef WLED_ENABLE_DOUBLE_BUFFER
+  if (restartBuffer) strip.startDoubleBuffer();
+  #endif
   yield();
   if (doSerializeConfig) serializeConfig();
 
@@ -415,6 +458,7 @@ pinManager.allocateMultiplePins(pins, sizeof(pins)/sizeof(managed_pin_type), Pin
   initPresetsFile();
 #endif
   updateFSInfo();
+  bootTime[BOOT_PHASE_FS] = millis();
 
   // generate module IDs must be done before AP setup
   escapedMac = WiFi.macAddress();
@@ -425,6 +469,7 @@ pinManager.allocateMultiplePins(pins, sizeof(pins)/sizeof(managed_pin_type), Pin
 
   DEBUG_PRINTLN(F("Reading config"));
   deserializeConfigFromFS();
+  bootTime[BOOT_PHASE_CFG] = millis();
 
 #if defined(STATUSLED) && STATUSLED>=0
   if (!pinManager.isPinAllocated(STATUSLED)) {
@@ -436,11 +481,22 @@ pinManager.allocateMultiplePins(pins, sizeof(pins)/sizeof(managed_pin_type), Pin
 
   DEBUG_PRINTLN(F("Initializing strip"));
   beginStrip();
+  bootTime[BOOT_PHASE_STRIP] = millis();
   DEBUG_PRINT(F("heap ")); DEBUG_PRINTLN(ESP.getFreeHeap());
 
+  if (fastBoot) {
+    // apply boot preset and show first frame before usermods, web server and network are brought up
+    DEBUG_PRINTLN(F("Fast boot"));
+    handlePresets();
+    handleTransitions();
+    strip.service();
+    handleBootTime();
+  }
+
   DEBUG_PRINTLN(F("Usermods setup"));
   userSetup();
   usermods.setup();
+  bootTime[BOOT_PHASE_UM] = millis();
   DEBUG_PRINT(F("heap ")); DEBUG_PRINTLN(ESP.getFreeHeap());
 
   if (strcmp(clientSSID, DEFAULT_CLIENT_SSID) == 0)
@@ -497,10 +553,18 @@ pinManager.allocateMultiplePins(pins, sizeof(pins)/sizeof(managed_pin_type), Pin
   // HTTP server page init
   DEBUG_PRINTLN(F("initServer"));
   initServer();
+  bootTime[BOOT_PHASE_SERVER] = millis();
   DEBUG_PRINT(F("heap ")); DEBUG_PRINTLN(ESP.getFreeHeap());
 
   enableWatchdog();
 
+  #ifdef WLED_ENABLE_RENDER_TASK
+  strip.startPipeline(); // render effects in own task from now on
+  #endif
+  #ifdef WLED_ENABLE_DOUBLE_BUFFER
+  strip.startDoubleBuffer();
+  #endif
+
   #if defined(ARDUINO_ARCH_ESP32) && defined(WLED_DISABLE_BROWNOUT_DET)
   WRITE_PERI_REG(RTC_CNTL_BROWN_OUT_REG, 1); //enable brownout detector
   #endif
@@ -790,6 +854,27 @@ void WLED::initInterfaces()
 #endif
   interfacesInited = true;
   wasConnected = true;
+  if (!bootTime[BOOT_PHASE_NET]) {
+    bootTime[BOOT_PHASE_NET] = millis();
+    handleBootTime();
+  }
+}
+
+// records time of first light (boot preset applied and shown) and prints boot phase timing once all phases completed
+void WLED::handleBootTime()
+{
+  if (!bootTime[BOOT_PHASE_LIGHT] && !presetToApply && strip.getLastShow()) bootTime[BOOT_PHASE_LIGHT] = millis();
+  if (!bootTime[BOOT_PHASE_LIGHT] || !bootTime[BOOT_PHASE_NET]) return;
+  #ifdef WLED_DEBUG
+  Print &out = DEBUGOUT;
+  #else
+  // printed like other status output only if serial is not used otherwise (TX pin, Adalight stream)
+  if (pinManager.isPinAllocated(hardwareTX) || realtimeMode == REALTIME_MODE_ADALIGHT) return;
+  Print &out = Serial;
+  #endif
+  out.printf_P(PSTR("Boot timing (ms): FS %lu, cfg %lu, strip %lu, light %lu, usermods %lu, server %lu, network %lu\n"),
+    bootTime[BOOT_PHASE_FS], bootTime[BOOT_PHASE_CFG], bootTime[BOOT_PHASE_STRIP], bootTime[BOOT_PHASE_LIGHT],
+    bootTime[BOOT_PHASE_UM], bootTime[BOOT_PHASE_SERVER], bootTime[BOOT_PHASE_NET]);
 }
 
 void WLED::handleConnection()
@@ -37,6 +37,10 @@
 #endif
 //#define WLED_ENABLE_DMX          // uses 3.5kb (use LEDPIN other than 2)
 #define WLED_ENABLE_JSONLIVE     // peek LED output via /json/live (WS binary peek is always enabled)
+//#define WLED_ENABLE_FX_REPLAY    // deterministic effect replay for regression tests (see tools/fx_replay.js)
+//#define WLED_ENABLE_RT_RECORD    // record DDP/E1.31/Art-Net streams to flash and play them back (see rt_record.cpp)
+//#define WLED_ENABLE_RENDER_TASK  // ESP32 (dual core): render effects in own task and send frames from output task (experimental, keep off)
+//#define WLED_ENABLE_DOUBLE_BUFFER // render next frame into back buffer while previous one is sent (4 bytes RAM per LED)
 #ifndef WLED_DISABLE_LOXONE
   #define WLED_ENABLE_LOXONE       // uses 1.2kb
 #endif
@@ -99,6 +103,15 @@
     #include <esp_now.h>
   #endif
 #endif
+#if defined(WLED_ENABLE_RENDER_TASK) && (!defined(ARDUINO_ARCH_ESP32) || defined(CONFIG_FREERTOS_UNICORE))
+  #undef WLED_ENABLE_RENDER_TASK   // requires dual core ESP32
+#endif
+#ifdef WLED_ENABLE_RENDER_TASK
+  #undef WLED_ENABLE_DOUBLE_BUFFER // frame queue already decouples rendering from output
+#endif
+#if defined(WLED_ENABLE_RENDER_TASK) || defined(WLED_ENABLE_DOUBLE_BUFFER)
+  #define WLED_PIXEL_CANVAS        // strip renders into own pixel buffer instead of bus buffers
+#endif
 #include <Wire.h>
 #include <SPI.h>
 
@@ -328,6 +341,14 @@ WLED_GLOBAL bool force802_3g _INIT(false);
 // LED CONFIG
 WLED_GLOBAL bool turnOnAtBoot _INIT(true);                // turn on LEDs at power-up
 WLED_GLOBAL byte bootPreset   _INIT(0);                   // save preset to load after power-up
+#ifdef WLED_FAST_BOOT
+WLED_GLOBAL bool fastBoot     _INIT(true);                // show boot preset before usermods and web server are initialized
+#else
+WLED_GLOBAL bool fastBoot     _INIT(false);
+#endif
+WLED_GLOBAL unsigned long bootTime[BOOT_PHASE_COUNT] _INIT_N(({0})); // millis() at the end of each boot phase
+WLED_GLOBAL unsigned long cfgLoadTime _INIT(0);           // time it took to read cfg.json at boot (ms)
+WLED_GLOBAL size_t        cfgPeakMem  _INIT(0);           // largest JSON buffer usage while reading cfg.json
 
 //if true, a segment per bus will be created on boot and LED settings save
 //if false, only one segment spanning the total LEDs is created,
@@ -629,6 +650,7 @@ WLED_GLOBAL unsigned long realtimeTimeout _INIT(0);
 WLED_GLOBAL uint8_t tpmPacketCount _INIT(0);
 WLED_GLOBAL uint16_t tpmPayloadFrameSize _INIT(0);
 WLED_GLOBAL bool useMainSegmentOnly _INIT(false);
+WLED_GLOBAL bool realtimeInterpolate _INIT(false);   // blend between received DDP/E1.31/Art-Net frames at target FPS
 
 WLED_GLOBAL unsigned long lastInterfaceUpdate _INIT(0);
 WLED_GLOBAL byte interfaceUpdateCallMode _INIT(CALL_MODE_INIT);
@@ -702,6 +724,7 @@ WLED_GLOBAL WiFiUDP ntpUdp;
 WLED_GLOBAL ESPAsyncE131 e131 _INIT_N(((handleE131Packet)));
 WLED_GLOBAL ESPAsyncE131 ddp  _INIT_N(((handleE131Packet)));
 WLED_GLOBAL bool e131NewData _INIT(false);
+WLED_GLOBAL bool e131FrameEnd _INIT(false); // complete frame received (DDP push, last universe or Art-Net sync)
 
 // led fx library object
 WLED_GLOBAL BusManager busses _INIT(BusManager());
@@ -860,6 +883,7 @@ public:
   void initConnection();
   void initInterfaces();
   void handleStatusLED();
+  void handleBootTime();
   void enableWatchdog();
   void disableWatchdog();
 };
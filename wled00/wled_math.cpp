@@ -137,3 +137,111 @@ float fmod_t(float num, float denom) {
   #endif
   return res;
 }
+
+
+/*
+ * Fixed point functions for effect inner loops (MCUs without FPU: ESP8266, ESP32-C3, ESP32-S2)
+ * Angles are 16 bit where 65536 is full circle (0 = +x axis, 16384 = +y axis), sin/cos return Q1.15 (-32767..32767).
+ * Table driven (quarter wave sine and first octant arctangent, 257 entries each) with linear interpolation.
+ * Max error (vs. libm): sin/cos < 2 LSB, atan2 < 2 angle units (0.011 deg).
+ */
+
+static const int16_t sinQuarterTable[257] PROGMEM = {
+      0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,  2009,  2210,  2410,  2611,  2811,  3012,
+   3212,  3412,  3612,  3811,  4011,  4210,  4410,  4609,  4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,
+   6393,  6590,  6786,  6983,  7179,  7375,  7571,  7767,  7962,  8157,  8351,  8545,  8739,  8933,  9126,  9319,
+   9512,  9704,  9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605, 11793, 11980, 12167, 12353,
+  12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828, 14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269,
+  15446, 15623, 15800, 15976, 16151, 16325, 16499, 16673, 16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037,
+  18204, 18371, 18537, 18703, 18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000, 20159, 20317, 20475, 20631,
+  20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856, 22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027,
+  23170, 23311, 23452, 23592, 23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680, 24811, 24942, 25072, 25201,
+  25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198, 26319, 26438, 26556, 26674, 26790, 26905, 27019, 27133,
+  27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001, 28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803,
+  28898, 28992, 29085, 29177, 29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+  30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783, 30852, 30919, 30985, 31050, 31113, 31176, 31237, 31297,
+  31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736, 31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098,
+  32137, 32176, 32213, 32250, 32285, 32318, 32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+  32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737, 32745, 32752, 32757, 32761, 32765, 32766,
+  32767
+};
+
+// atan(i/256) for i = 0..256 in 16 bit angle units (atan(1) = 8192)
+static const uint16_t atanOctantTable[257] PROGMEM = {
+      0,    41,    81,   122,   163,   204,   244,   285,   326,   367,   407,   448,   489,   529,   570,   610,
+    651,   692,   732,   773,   813,   854,   894,   935,   975,  1015,  1056,  1096,  1136,  1177,  1217,  1257,
+   1297,  1337,  1377,  1417,  1457,  1497,  1537,  1577,  1617,  1656,  1696,  1736,  1775,  1815,  1854,  1894,
+   1933,  1973,  2012,  2051,  2090,  2129,  2168,  2207,  2246,  2285,  2324,  2363,  2401,  2440,  2478,  2517,
+   2555,  2594,  2632,  2670,  2708,  2746,  2784,  2822,  2860,  2897,  2935,  2973,  3010,  3047,  3085,  3122,
+   3159,  3196,  3233,  3270,  3307,  3344,  3380,  3417,  3453,  3490,  3526,  3562,  3599,  3635,  3670,  3706,
+   3742,  3778,  3813,  3849,  3884,  3920,  3955,  3990,  4025,  4060,  4095,  4129,  4164,  4199,  4233,  4267,
+   4302,  4336,  4370,  4404,  4438,  4471,  4505,  4539,  4572,  4605,  4639,  4672,  4705,  4738,  4771,  4803,
+   4836,  4869,  4901,  4933,  4966,  4998,  5030,  5062,  5094,  5125,  5157,  5188,  5220,  5251,  5282,  5313,
+   5344,  5375,  5406,  5437,  5467,  5498,  5528,  5559,  5589,  5619,  5649,  5679,  5708,  5738,  5768,  5797,
+   5826,  5856,  5885,  5914,  5943,  5972,  6000,  6029,  6058,  6086,  6114,  6142,  6171,  6199,  6227,  6254,
+   6282,  6310,  6337,  6365,  6392,  6419,  6446,  6473,  6500,  6527,  6554,  6580,  6607,  6633,  6660,  6686,
+   6712,  6738,  6764,  6790,  6815,  6841,  6867,  6892,  6917,  6943,  6968,  6993,  7018,  7043,  7068,  7092,
+   7117,  7141,  7166,  7190,  7214,  7238,  7262,  7286,  7310,  7334,  7358,  7381,  7405,  7428,  7451,  7475,
+   7498,  7521,  7544,  7566,  7589,  7612,  7635,  7657,  7679,  7702,  7724,  7746,  7768,  7790,  7812,  7834,
+   7856,  7877,  7899,  7920,  7942,  7963,  7984,  8005,  8026,  8047,  8068,  8089,  8110,  8131,  8151,  8172,
+   8192
+};
+
+int16_t sin_fixed(uint16_t angle) {
+  uint16_t idx = angle & 0x3FFF;          // position within quadrant
+  if (angle & 0x4000) idx = 0x4000 - idx; // 2nd and 4th quadrant are mirrored
+  uint8_t  frac = idx & 0x3F;
+  idx >>= 6;
+  int16_t res = pgm_read_word(&sinQuarterTable[idx]);
+  if (frac) res += ((int16_t(pgm_read_word(&sinQuarterTable[idx+1])) - res) * frac) >> 6;
+  if (angle & 0x8000) res = -res;         // 3rd and 4th quadrant are negative
+  #ifdef WLED_DEBUG_MATH
+  Serial.printf("sin_fixed: %u,%d,%f\n",angle,res,32767*sin(angle*TWO_PI/65536));
+  #endif
+  return res;
+}
+
+int16_t cos_fixed(uint16_t angle) {
+  return sin_fixed(angle + 16384);
+}
+
+uint16_t atan2_fixed(int32_t y, int32_t x) {
+  uint32_t ax = x < 0 ? -x : x;
+  uint32_t ay = y < 0 ? -y : y;
+  if (ax == 0 && ay == 0) return 0;
+  while ((ax | ay) & 0xFFFF0000UL) { ax >>= 1; ay >>= 1; } // keep ratio calculation within 32 bits (16 bits keep large coordinates accurate)
+  bool swap = ay > ax;
+  uint32_t r = swap ? (ax << 16) / ay : (ay << 16) / ax;    // 0..65536 (Q16 tangent of first octant)
+  uint16_t idx = r >> 8;
+  uint8_t  frac = r & 0xFF;
+  uint16_t res = pgm_read_word(&atanOctantTable[idx]);
+  if (frac) res += ((pgm_read_word(&atanOctantTable[idx+1]) - res) * frac + 128) >> 8; // rounded
+  if (swap)  res = 16384 - res;
+  if (x < 0) res = 32768 - res;
+  if (y < 0) res = -res;
+  #ifdef WLED_DEBUG_MATH
+  Serial.printf("atan2_fixed: %d,%d,%u,%f\n",y,x,res,65536*atan2(y,x)/TWO_PI);
+  #endif
+  return res;
+}
+
+// integer square root (floor)
+uint16_t sqrt_fixed(uint32_t x) {
+  uint32_t res = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > x) bit >>= 2;
+  while (bit) {
+    if (x >= res + bit) {
+      x  -= res + bit;
+      res = (res >> 1) + bit;
+    } else
+      res >>= 1;
+    bit >>= 2;
+  }
+  return res;
+}
+
+// x and y must be within +/-46340 (result within 16 bits)
+uint16_t hypot_fixed(int32_t x, int32_t y) {
+  return sqrt_fixed(uint32_t(x*x) + uint32_t(y*y));
+}
@@ -11,14 +11,14 @@ enum class AdaState {
   Header_CountHi,
   Header_CountLo,
   Header_CountCheck,
-  Data_Red,
-  Data_Green,
-  Data_Blue,
+  Data,
   TPM2_Header_Type,
   TPM2_Header_CountHi,
   TPM2_Header_CountLo,
 };
 
+#define SERIAL_BLOCK_SIZE 192 // pixel data bytes read at once (multiple of 3)
+
 uint16_t currentBaud = 1152; //default baudrate 115200 (divided by 100)
 bool continuousSendLED = false;
 uint32_t lastUpdate = 0;
@@ -40,12 +40,17 @@ void updateBaudRate(uint32_t rate){
 void sendJSON(){
   if (!pinManager.isPinAllocated(hardwareTX) || pinManager.getPinOwner(hardwareTX) == PinOwner::DebugOut) {
     uint16_t used = strip.getLengthTotal();
-    Serial.write('[');
+    char buf[SERIAL_BLOCK_SIZE];
+    size_t len = 0;
+    buf[len++] = '[';
     for (uint16_t i=0; i<used; i++) {
-      Serial.print(strip.getPixelColor(i));
-      if (i != used-1) Serial.write(',');
+      if (len > sizeof(buf) - 12) { Serial.write((const uint8_t*)buf, len); len = 0; } // room for 10 digits + ',' + ']'
+      len += sprintf_P(buf + len, PSTR("%lu"), (unsigned long)strip.getPixelColor(i));
+      if (i != used-1) buf[len++] = ',';
     }
-    Serial.println("]");
+    buf[len++] = ']';
+    Serial.write((const uint8_t*)buf, len);
+    Serial.println();
   }
 }
 
@@ -57,13 +62,18 @@ void sendBytes(){
     uint16_t len = used*3;
     Serial.write(highByte(len));
     Serial.write(lowByte(len));
+    uint8_t buf[SERIAL_BLOCK_SIZE];
+    size_t n = 0;
     for (uint16_t i=0; i < used; i++) {
       uint32_t c = strip.getPixelColor(i);
-      Serial.write(qadd8(W(c), R(c))); //R, add white channel to RGB channels as a simple RGBW -> RGB map
-      Serial.write(qadd8(W(c), G(c))); //G
-      Serial.write(qadd8(W(c), B(c))); //B
+      buf[n++] = qadd8(W(c), R(c)); //R, add white channel to RGB channels as a simple RGBW -> RGB map
+      buf[n++] = qadd8(W(c), G(c)); //G
+      buf[n++] = qadd8(W(c), B(c)); //B
+      if (n == sizeof(buf)) { Serial.write(buf, n); n = 0; }
     }
-    Serial.write(0x36); Serial.write('\n');
+    buf[n++] = 0x36; // fits: buffer is flushed whenever full
+    buf[n++] = '\n';
+    Serial.write(buf, n);
   }
 }
 
@@ -74,15 +84,36 @@ void handleSerial()
 
   #ifdef WLED_ENABLE_ADALIGHT
   static auto state = AdaState::Header_A;
-  static uint16_t count = 0;
+  static uint16_t count = 0;     // pixels still to be received
   static uint16_t pixel = 0;
   static byte check = 0x00;
-  static byte red   = 0x00;
-  static byte green = 0x00;
+  static byte part[2];           // bytes of an incomplete pixel at end of last block
+  static uint8_t partLen = 0;
 
   while (Serial.available() > 0)
   {
-    yield();
+    if (state == AdaState::Data) {
+      // pixel data is read in blocks and written as pixel spans (headers & commands are parsed byte by byte below)
+      byte buf[SERIAL_BLOCK_SIZE + 2];
+      memcpy(buf, part, partLen);
+      size_t want = MIN((size_t)count*3 - partLen, (size_t)SERIAL_BLOCK_SIZE);
+      size_t len  = partLen + Serial.readBytes(buf + partLen, MIN((size_t)Serial.available(), want)); // never blocks
+      uint16_t pixels = len / 3;
+      if (!realtimeOverride) setRealtimePixels(pixel, buf, pixels);
+      pixel += pixels;
+      count -= pixels;
+      partLen = len - pixels*3;
+      memcpy(part, buf + pixels*3, partLen);
+      continuousSendLED = false; // all other received bytes disable Continuous Serial Streaming
+      if (!count) {
+        realtimeLock(realtimeTimeoutMs, REALTIME_MODE_ADALIGHT);
+        if (!realtimeOverride) strip.show();
+        state = AdaState::Header_A;
+      }
+      yield();
+      continue;
+    }
+
     byte next = Serial.peek();
     switch (state) {
       case AdaState::Header_A:
@@ -145,6 +176,7 @@ void handleSerial()
         break;
       case AdaState::Header_CountHi:
         pixel = 0;
+        partLen = 0;
         count = next * 0x100;
         check = next;
         state = AdaState::Header_CountLo;
@@ -155,8 +187,8 @@ void handleSerial()
         state = AdaState::Header_CountCheck;
         break;
       case AdaState::Header_CountCheck:
-        if (check == next) state = AdaState::Data_Red;
-        else               state = AdaState::Header_A;
+        if (check == next && count) state = AdaState::Data;
+        else                        state = AdaState::Header_A;
         break;
       case AdaState::TPM2_Header_Type:
         state = AdaState::Header_A; //(unsupported) TPM2 command or invalid type
@@ -165,31 +197,15 @@ void handleSerial()
         break;
       case AdaState::TPM2_Header_CountHi:
         pixel = 0;
-        count = (next * 0x100) /3;
+        partLen = 0;
+        count = next; // byte count high byte
         state = AdaState::TPM2_Header_CountLo;
         break;
       case AdaState::TPM2_Header_CountLo:
-        count += next /3;
-        state = AdaState::Data_Red;
+        count = ((count << 8) | next) /3;
+        state = count ? AdaState::Data : AdaState::Header_A;
         break;
-      case AdaState::Data_Red:
-        red   = next;
-        state = AdaState::Data_Green;
-        break;
-      case AdaState::Data_Green:
-        green = next;
-        state = AdaState::Data_Blue;
-        break;
-      case AdaState::Data_Blue:
-        byte blue  = next;
-        if (!realtimeOverride) setRealtimePixel(pixel++, red, green, blue, 0);
-        if (--count > 0) state = AdaState::Data_Red;
-        else {
-          realtimeLock(realtimeTimeoutMs, REALTIME_MODE_ADALIGHT);
-
-          if (!realtimeOverride) strip.show();
-          state = AdaState::Header_A;
-        }
+      default:
         break;
     }
 
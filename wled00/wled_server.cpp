@@ -64,6 +64,14 @@ void handleUpload(AsyncWebServerRequest *request, const String& filename, size_t
       request->send(200, "text/plain", F("Configuration restore successful.\nRebooting..."));
     } else {
       if (filename.indexOf(F("palette")) >= 0 && filename.indexOf(F(".json")) >= 0) strip.loadCustomPalettes();
+      if (filename.indexOf(F("ledmap")) >= 0 && filename.indexOf(F(".json")) >= 0) {
+        // binary ledmap takes precedence, remove stale one so that uploaded JSON is used
+        String binName = filename.substring(0, filename.lastIndexOf('.')) + F(".bin");
+        if (binName.charAt(0) != '/') binName = '/' + binName;
+        if (WLED_FS.exists(binName)) WLED_FS.remove(binName);
+      }
+      // composed matrix mapping is cached, mtime in its key is not reliable (LittleFS may have no time set)
+      if (filename.indexOf(F("ledmap")) >= 0 || filename.indexOf(F("2d-gaps.json")) >= 0) WLED_FS.remove(F("/2d-cache.bin"));
       request->send(200, "text/plain", F("File Uploaded!"));
     }
     cacheInvalidate++;
@@ -177,12 +185,14 @@ void initServer()
     bool verboseResponse = false;
     bool isConfig = false;
 
-    if (!requestJSONBufferLock(14)) return;
+    strip.lockRender(); // render lock before JSON buffer (lock order), state/config may change segments
+    if (!requestJSONBufferLock(14)) { strip.unlockRender(); return; }
 
     DeserializationError error = deserializeJson(doc, (uint8_t*)(request->_tempObject));
     JsonObject root = doc.as<JsonObject>();
     if (error || root.isNull()) {
       releaseJSONBufferLock();
+      strip.unlockRender();
       request->send(400, "application/json", F("{\"error\":9}")); // ERR_JSON
       return;
     }
@@ -203,11 +213,13 @@ void initServer()
       if (!correctPIN && strlen(settingsPIN)>0) {
         request->send(401, "application/json", F("{\"error\":1}")); // ERR_DENIED
         releaseJSONBufferLock();
+        strip.unlockRender();
         return;
       }
       verboseResponse = deserializeConfig(root); //use verboseResponse to determine whether cfg change should be saved immediately
     }
     releaseJSONBufferLock();
+    strip.unlockRender();
 
     if (verboseResponse) {
       if (!isConfig) {
@@ -403,10 +415,13 @@ void initServer()
       return;
     }
 
-    if(handleSet(request, request->url())) return;
+    strip.lockRender();
+    bool handled = handleSet(request, request->url());
     #ifndef WLED_DISABLE_ALEXA
-    if(espalexa.handleAlexaApiCall(request)) return;
+    if (!handled) handled = espalexa.handleAlexaApiCall(request);
     #endif
+    strip.unlockRender();
+    if (handled) return;
     if(handleFileRead(request, request->url())) return;
     AsyncWebServerResponse *response = request->beginResponse_P(404, "text/html", PAGE_404, PAGE_404_length);
     response->addHeader(FPSTR(s_content_enc),"gzip");
@@ -590,7 +605,11 @@ void serveSettings(AsyncWebServerRequest* request, bool post)
   }
 
   if (post) { //settings/set POST request, saving
-    if (subPage != SUBPAGE_WIFI || !(wifiLock && otaLock)) handleSettingsSet(request, subPage);
+    if (subPage != SUBPAGE_WIFI || !(wifiLock && otaLock)) {
+      strip.lockRender();
+      handleSettingsSet(request, subPage);
+      strip.unlockRender();
+    }
 
     char s[32];
     char s2[45] = "";
@@ -36,12 +36,14 @@ void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventTyp
         }
 
         bool verboseResponse = false;
-        if (!requestJSONBufferLock(11)) return;
+        strip.lockRender(); // render lock before JSON buffer (lock order)
+        if (!requestJSONBufferLock(11)) { strip.unlockRender(); return; }
 
         DeserializationError error = deserializeJson(doc, data, len);
         JsonObject root = doc.as<JsonObject>();
         if (error || root.isNull()) {
           releaseJSONBufferLock();
+          strip.unlockRender();
           return;
         }
         if (root["v"] && root.size() == 1) {
@@ -53,6 +55,7 @@ void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventTyp
           verboseResponse = deserializeState(root);
         }
         releaseJSONBufferLock(); // will clean fileDoc
+        strip.unlockRender();
 
         if (!interfaceUpdateCallMode) { // individual client response only needed if no WS broadcast soon
           if (verboseResponse) {
@@ -101,12 +104,14 @@ void sendDataWs(AsyncWebSocketClient * client)
   if (!ws.count()) return;
   AsyncWebSocketMessageBuffer * buffer;
 
-  if (!requestJSONBufferLock(12)) return;
+  strip.lockRender(); // segments must not change while being serialized (render lock before JSON buffer)
+  if (!requestJSONBufferLock(12)) { strip.unlockRender(); return; }
 
   JsonObject state = doc.createNestedObject("state");
   serializeState(state);
   JsonObject info  = doc.createNestedObject("info");
   serializeInfo(info);
+  strip.unlockRender();
 
   size_t len = measureJson(doc);
   DEBUG_PRINTF("JSON buffer size: %u for WS request (%u).\n", doc.memoryUsage(), len);
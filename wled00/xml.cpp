@@ -349,6 +349,9 @@ void getSettingsJS(byte subPage, char* dest)
     oappend(itoa(MAX_LED_MEMORY,nS,10));   oappend(",");
     oappend(itoa(MAX_LEDS,nS,10));
     oappend(SET_F(");"));
+    #ifdef WLED_ENABLE_PARALLEL_BUS
+    oappend(SET_F("parB=1;")); // offer TYPE_WS2812_PARALLEL
+    #endif
 
     sappend('c',SET_F("MS"),autoSegments);
     sappend('c',SET_F("CCT"),correctWB);
@@ -372,9 +375,10 @@ void getSettingsJS(byte subPage, char* dest)
       char aw[4] = "AW"; aw[2] = 48+s; aw[3] = 0; //auto white mode
       char wo[4] = "WO"; wo[2] = 48+s; wo[3] = 0; //swap channels
       char sp[4] = "SP"; sp[2] = 48+s; sp[3] = 0; //bus clock speed
+      char nd[4] = "ND"; nd[2] = 48+s; nd[3] = 0; //additional network destinations
       oappend(SET_F("addLEDs(1);"));
-      uint8_t pins[5];
-      uint8_t nPins = bus->getPins(pins);
+      uint8_t pins[WLED_MAX_BUS_PINS];
+      uint8_t nPins = MIN(bus->getPins(pins), WLED_MAX_BUS_CFG_PINS); // settings page has 5 pin fields
       for (uint8_t i = 0; i < nPins; i++) {
         lp[1] = 48+i;
         if (pinManager.isPinOk(pins[i]) || bus->getType()>=TYPE_NET_DDP_RGB) sappend('v',lp,pins[i]);
@@ -388,6 +392,15 @@ void getSettingsJS(byte subPage, char* dest)
       sappend('c',rf,bus->isOffRefreshRequired());
       sappend('v',aw,bus->getAutoWhiteMode());
       sappend('v',wo,bus->getColorOrder() >> 4);
+      if (IS_NETWORK(bus->getType())) {
+        BusNetwork *nb = static_cast<BusNetwork*>(bus);
+        char dst[WLED_MAX_NET_DEST*16] = {'\0'};
+        for (uint8_t i = 1; i < nb->getNumDestinations(); i++) {
+          if (i > 1) strcat(dst, ",");
+          strcat(dst, nb->getDestination(i).ip.toString().c_str());
+        }
+        sappends('s',nd,dst);
+      }
       uint16_t speed = bus->getFrequency();
       if (bus->getType() > TYPE_ONOFF && bus->getType() < 48) {
         switch (speed) {
@@ -513,6 +526,7 @@ void getSettingsJS(byte subPage, char* dest)
     sappend('v',SET_F("ET"),realtimeTimeoutMs);
     sappend('c',SET_F("FB"),arlsForceMaxBri);
     sappend('c',SET_F("RG"),arlsDisableGammaCorrection);
+    sappend('c',SET_F("RI"),realtimeInterpolate);
     sappend('v',SET_F("WO"),arlsOffset);
     sappend('c',SET_F("AL"),alexaEnabled);
     sappends('s',SET_F("AI"),alexaInvocationName);